@@ -0,0 +1,71 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripAPA102.h"
+
+LedStripAPA102::LedStripAPA102(uint16_t ledCount, uint8_t pinData, uint8_t pinClock) : LedStripBase(ledCount) {
+    // Set the fields
+    this->pinData = pinData;
+    this->pinClock = pinClock;
+
+    // Configure and set the adapter
+    this->setAdapter(new LedStripAdapterAPA102(ledCount, pinData, pinClock));
+}
+
+LedStripAPA102::LedStripAPA102(uint16_t ledCount, uint32_t spiClock) : LedStripBase(ledCount) {
+    // The hardware SPI pins depend on the board
+    this->pinData = LED_STRIP_APA102_PIN_HARDWARE_SPI;
+    this->pinClock = LED_STRIP_APA102_PIN_HARDWARE_SPI;
+
+    // Configure and set the adapter
+    this->setAdapter(new LedStripAdapterAPA102(ledCount, spiClock));
+}
+
+LedStripAPA102::~LedStripAPA102() { }
+
+uint8_t LedStripAPA102::getDataPin() {
+    return this->pinData;
+}
+
+uint8_t LedStripAPA102::getClockPin() {
+    return this->pinClock;
+}
+
+LedStripAdapterAPA102* LedStripAPA102::getAPA102Adapter() {
+    return (LedStripAdapterAPA102*) this->getAdapter();
+}
+
+uint32_t LedStripAPA102::getSpiClock() {
+    return this->getAPA102Adapter()->getSpiClock();
+}
+
+void LedStripAPA102::setSpiClock(uint32_t spiClock) {
+    this->getAPA102Adapter()->setSpiClock(spiClock);
+}
+
+void LedStripAPA102::init() {
+    this->getAdapter()->init();
+}
+
+void LedStripAPA102::init(bool render) {
+    this->getAdapter()->init(render);
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPAPA102_H
+#define LEDSTRIPDRIVER_LEDSTRIPAPA102_H
+
+#include "LedStripBase.h"
+#include "LedStripAdapterAPA102.h"
+
+/**
+ * Pin number reported for the data and clock pins of LED strips on the hardware SPI pins.
+ */
+#define LED_STRIP_APA102_PIN_HARDWARE_SPI 0xFF
+
+/**
+ * LedStrip class for APA102 and SK9822 type LED strips.
+ * The alpha channel of each LED color sets the 5-bit global brightness of that LED.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripAPA102 : public LedStripBase {
+private:
+    /**
+     * Pin used for data transfer to the LED strip.
+     */
+    uint8_t pinData;
+
+    /**
+     * Pin used for the data clock signal.
+     */
+    uint8_t pinClock;
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param ledCount Number of LEDs on this LED strip.
+     * @param pinData Arduino PIN for data.
+     * @param pinClock Arduino PIN for clock.
+     */
+    LedStripAPA102(uint16_t ledCount, uint8_t pinData, uint8_t pinClock);
+
+    /**
+     * Constructor, for LED strips on the hardware SPI pins.
+     *
+     * @param ledCount Number of LEDs on this LED strip.
+     * @param spiClock SPI clock in Hz, such as APA102_SPI_CLOCK_DEFAULT.
+     */
+    LedStripAPA102(uint16_t ledCount, uint32_t spiClock);
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "HidingNonVirtualFunction"
+    /**
+     * Destructor.
+     */
+    ~LedStripAPA102();
+#pragma clang diagnostic pop
+
+    /**
+     * Get the Arduino pin used for the data signal.
+     *
+     * @return Data pin, or LED_STRIP_APA102_PIN_HARDWARE_SPI.
+     */
+    uint8_t getDataPin();
+
+    /**
+     * Get the Arduino pin used for the clock signal.
+     *
+     * @return Clock pin, or LED_STRIP_APA102_PIN_HARDWARE_SPI.
+     */
+    uint8_t getClockPin();
+
+    /**
+     * Get the APA102 LED strip adapter.
+     *
+     * @return APA102 LED strip adapter.
+     */
+    LedStripAdapterAPA102* getAPA102Adapter();
+
+    /**
+     * Get the hardware SPI clock.
+     *
+     * @return SPI clock in Hz.
+     */
+    uint32_t getSpiClock();
+
+    /**
+     * Set the hardware SPI clock, applied from the next render.
+     *
+     * @param spiClock SPI clock in Hz.
+     */
+    void setSpiClock(uint32_t spiClock);
+
+    // Override virtual method in BaseLedStrip class
+    void init();
+
+    // Override virtual method in BaseLedStrip class
+    void init(bool render);
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPAPA102_H
\ No newline at end of file
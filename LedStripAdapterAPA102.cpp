@@ -0,0 +1,344 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "SPI.h"
+#include "LedStripAdapterAPA102.h"
+
+LedStripAdapterAPA102::LedStripAdapterAPA102(uint16_t ledCount, uint8_t pinData, uint8_t pinClock) {
+    // Set the fields
+    this->ledCount = ledCount;
+    this->frame = NULL;
+    this->hardwareSpi = false;
+    this->pinData = pinData;
+    this->pinClock = pinClock;
+    this->spiClock = APA102_SPI_CLOCK_DEFAULT;
+#ifdef LED_STRIP_PORT_REGISTERS
+    this->dataPort = NULL;
+    this->clockPort = NULL;
+#endif
+    this->transmitTime = 0;
+
+    // Allocate the frame buffer, the hardware state is unknown so make sure the first render outputs everything
+    this->allocate();
+    this->invalidate();
+}
+
+LedStripAdapterAPA102::LedStripAdapterAPA102(uint16_t ledCount, uint32_t spiClock) :
+        LedStripAdapterAPA102(ledCount, (uint8_t) 0, (uint8_t) 0) {
+    // Use the hardware SPI pins
+    this->hardwareSpi = true;
+    this->spiClock = spiClock;
+}
+
+LedStripAdapterAPA102::~LedStripAdapterAPA102() {
+    // Explicitly delete the dynamically allocated frame buffer
+    free(this->frame);
+}
+
+void LedStripAdapterAPA102::allocate() {
+    // Determine the frame size
+    this->frameSize = LedStripPixelAPA102::START_FRAME_SIZE + (uint32_t) this->ledCount * LedStripPixelAPA102::BYTES_PER_PIXEL +
+                      LedStripPixelAPA102::getEndFrameSize(this->ledCount);
+
+    // Allocate the zeroed frame buffer, the start and end frames stay zeroed
+    free(this->frame);
+    if((this->frame = (uint8_t*) calloc(this->frameSize, 1)) == NULL) {
+        this->ledCount = 0;
+        this->frameSize = 0;
+        return;
+    }
+
+    // Set all LEDs to black at full brightness
+    for(uint16_t i = 0; i < this->ledCount; i++)
+        this->getPixel(i)[LedStripPixelAPA102::BRIGHTNESS_INDEX] =
+                LedStripPixelAPA102::encodeBrightness(LED_STRIP_COLOR_VALUE_MAX);
+}
+
+uint8_t* LedStripAdapterAPA102::getPixel(uint16_t ledIndex) {
+    return &this->frame[LedStripPixelAPA102::START_FRAME_SIZE + (uint32_t) ledIndex * LedStripPixelAPA102::BYTES_PER_PIXEL];
+}
+
+bool LedStripAdapterAPA102::writePixel(uint8_t* pixel, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel,
+                                       uint8_t alphaChannel) {
+    // Encode the pixel, and compare it as a whole against the current one
+    uint8_t native[LedStripPixelAPA102::BYTES_PER_PIXEL];
+    LedStripPixelAPA102::encode(native, redChannel, greenChannel, blueChannel, alphaChannel);
+    if(memcmp(pixel, native, LedStripPixelAPA102::BYTES_PER_PIXEL) == 0)
+        return false;
+
+    memcpy(pixel, native, LedStripPixelAPA102::BYTES_PER_PIXEL);
+    return true;
+}
+
+uint32_t LedStripAdapterAPA102::getSpiClock() {
+    return this->spiClock;
+}
+
+void LedStripAdapterAPA102::setSpiClock(uint32_t spiClock) {
+    this->spiClock = spiClock;
+}
+
+void LedStripAdapterAPA102::init() {
+    this->init(false);
+}
+
+void LedStripAdapterAPA102::init(bool render) {
+    if(this->hardwareSpi) {
+        // Enable the SPI hardware, cores without transactions get their settings once, here
+        SPI.begin();
+#ifndef SPI_HAS_TRANSACTION
+        SPI.setBitOrder(MSBFIRST);
+        SPI.setDataMode(SPI_MODE0);
+
+        // Pick the fastest divider that doesn't exceed the SPI clock
+        static const uint8_t dividers[] = {
+            SPI_CLOCK_DIV2, SPI_CLOCK_DIV4, SPI_CLOCK_DIV8, SPI_CLOCK_DIV16,
+            SPI_CLOCK_DIV32, SPI_CLOCK_DIV64, SPI_CLOCK_DIV128
+        };
+        uint32_t clock = F_CPU / 2;
+        uint8_t divider = 0;
+        while(divider < 6 && clock > this->spiClock) {
+            clock >>= 1;
+            divider++;
+        }
+        SPI.setClockDivider(dividers[divider]);
+#endif
+
+    } else {
+        // Set up the pins, the clock idles low
+        pinMode(this->pinData, OUTPUT);
+        pinMode(this->pinClock, OUTPUT);
+        digitalWrite(this->pinClock, LOW);
+
+#ifdef LED_STRIP_PORT_REGISTERS
+        // Resolve the port registers once, so each frame can be bit-banged through them directly
+        this->dataPort = portOutputRegister(digitalPinToPort(this->pinData));
+        this->clockPort = portOutputRegister(digitalPinToPort(this->pinClock));
+        this->dataPinMask = digitalPinToBitMask(this->pinData);
+        this->clockPinMask = digitalPinToBitMask(this->pinClock);
+#endif
+    }
+
+    // Render the LED strip
+    if(render) {
+        this->invalidate();
+        this->render();
+    }
+}
+
+void LedStripAdapterAPA102::render() {
+    // Skip rendering if nothing has changed since the last frame
+    if(!this->isDirty())
+        return;
+
+    // Transmit the frame
+    unsigned long start = micros();
+    if(this->hardwareSpi)
+        this->transmitSpi();
+    else
+        this->transmitBitbang();
+    this->transmitTime = micros() - start;
+    this->markRendered();
+}
+
+void LedStripAdapterAPA102::transmitSpi() {
+    uint8_t* ptr = this->frame;
+    uint32_t i = this->frameSize;
+
+#ifdef SPI_HAS_TRANSACTION
+    SPI.beginTransaction(SPISettings(this->spiClock, MSBFIRST, SPI_MODE0));
+#endif
+
+#if defined(__AVR__)
+    // Write SPDR directly, so the next byte is prepared while the prior one is shifted out
+    if(i) {
+        SPDR = *ptr++;
+        while(--i) {
+            uint8_t p = *ptr++;
+            while(!(SPSR & (1 << SPIF)));
+            SPDR = p;
+        }
+        while(!(SPSR & (1 << SPIF)));
+    }
+#else
+    while(i--)
+        SPI.transfer(*ptr++);
+#endif
+
+#ifdef SPI_HAS_TRANSACTION
+    SPI.endTransaction();
+#endif
+}
+
+void LedStripAdapterAPA102::transmitBitbang() {
+    uint8_t* ptr = this->frame;
+    uint32_t i = this->frameSize;
+
+#ifdef LED_STRIP_PORT_REGISTERS
+    if(this->dataPort != NULL) {
+        // Copy the registers and masks to locals, so they stay in CPU registers
+        LedStripPortReg* dataPort = this->dataPort;
+        LedStripPortReg* clockPort = this->clockPort;
+        LedStripPortMask dataPinMask = this->dataPinMask;
+        LedStripPortMask clockPinMask = this->clockPinMask;
+
+        // Shift out each byte, most significant bit first, the data is sampled on the rising clock edge
+        while(i--) {
+            uint8_t p = *ptr++;
+            for(uint8_t bit = 0x80; bit; bit >>= 1) {
+                if(p & bit)
+                    *dataPort |= dataPinMask;
+                else
+                    *dataPort &= ~dataPinMask;
+                *clockPort |= clockPinMask;
+                *clockPort &= ~clockPinMask;
+            }
+        }
+        return;
+    }
+#endif
+
+    // Fall back to digitalWrite() on cores without port register access
+    while(i--) {
+        uint8_t p = *ptr++;
+        for(uint8_t bit = 0x80; bit; bit >>= 1) {
+            digitalWrite(this->pinData, (p & bit) ? HIGH : LOW);
+            digitalWrite(this->pinClock, HIGH);
+            digitalWrite(this->pinClock, LOW);
+        }
+    }
+}
+
+uint16_t LedStripAdapterAPA102::getLedCount() {
+    return this->ledCount;
+}
+
+void LedStripAdapterAPA102::setLedCount(uint16_t ledCount) {
+    // Reallocate the frame buffer, and make sure the resized strip is rendered
+    this->ledCount = ledCount;
+    this->allocate();
+    this->invalidate();
+}
+
+LedStripColor LedStripAdapterAPA102::getLedColor(uint16_t ledIndex) {
+    // Make sure the LED is on the strip
+    if(ledIndex >= this->ledCount)
+        return LedStripColor::black();
+
+    return LedStripPixelAPA102::decode(this->getPixel(ledIndex));
+}
+
+void LedStripAdapterAPA102::setLedColor(uint16_t ledIndex, LedStripColor color) {
+    this->setLedColor(ledIndex, color.getRed(), color.getGreen(), color.getBlue(), color.getAlpha());
+}
+
+void LedStripAdapterAPA102::setLedColor(uint16_t ledIndex, uint8_t redChannel) {
+    // Get the color of the LED
+    LedStripColor ledColor = this->getLedColor(ledIndex);
+
+    // Set the red channel
+    ledColor.setRed(redChannel);
+
+    // Update the led color
+    this->setLedColor(ledIndex, ledColor);
+}
+
+void LedStripAdapterAPA102::setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel) {
+    // Get the color of the LED
+    LedStripColor ledColor = this->getLedColor(ledIndex);
+
+    // Set the red and green channel
+    ledColor.setRed(redChannel);
+    ledColor.setGreen(greenChannel);
+
+    // Update the led color
+    this->setLedColor(ledIndex, ledColor);
+}
+
+void LedStripAdapterAPA102::setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel,
+                                        uint8_t blueChannel) {
+    this->setLedColor(ledIndex, redChannel, greenChannel, blueChannel, (uint8_t) LED_STRIP_COLOR_VALUE_MAX);
+}
+
+void LedStripAdapterAPA102::setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel,
+                                        uint8_t blueChannel, uint8_t alphaChannel) {
+    // Make sure the LED is on the strip
+    if(ledIndex >= this->ledCount)
+        return;
+
+    // Write the pixel, and mark the LED as dirty if it changed
+    if(this->writePixel(this->getPixel(ledIndex), redChannel, greenChannel, blueChannel, alphaChannel))
+        this->markDirty(ledIndex, ledIndex + 1, 1);
+}
+
+uint32_t LedStripAdapterAPA102::getLedColorCombinedChannels(uint16_t ledIndex) {
+    return this->getLedColor(ledIndex).getCombinedChannels();
+}
+
+void LedStripAdapterAPA102::setLedColorCombinedChannels(uint16_t ledIndex, uint32_t combinedColorValue) {
+    this->setLedColor(ledIndex, LedStripColor::fromCombinedChannels(combinedColorValue));
+}
+
+void LedStripAdapterAPA102::setLedColors(uint16_t fromLedIndex, LedStripColor* colors, uint16_t count) {
+    // Clip the span to the strip once, instead of bounds checking each LED
+    if(fromLedIndex >= this->ledCount)
+        return;
+    if(count > this->ledCount - fromLedIndex)
+        count = this->ledCount - fromLedIndex;
+
+    // Write the colors straight into the frame buffer, and keep track of the changed range
+    uint8_t* pixel = this->getPixel(fromLedIndex);
+    uint16_t changedFrom = count, changedTo = 0, changedCount = 0;
+    for(uint16_t i = 0; i < count; i++, pixel += LedStripPixelAPA102::BYTES_PER_PIXEL) {
+        if(this->writePixel(pixel, colors[i].getRed(), colors[i].getGreen(), colors[i].getBlue(), colors[i].getAlpha())) {
+            if(changedCount++ == 0)
+                changedFrom = i;
+            changedTo = i + 1;
+        }
+    }
+
+    // Mark the changed range as dirty
+    this->markDirty(fromLedIndex + changedFrom, fromLedIndex + changedTo, changedCount);
+}
+
+uint32_t LedStripAdapterAPA102::getTransferRate() {
+    if(this->transmitTime == 0)
+        return 0;
+    return (uint32_t) ((uint64_t) this->frameSize * 1000000UL / this->transmitTime);
+}
+
+uint8_t* LedStripAdapterAPA102::getNativePixels() {
+    return this->ledCount > 0 ? this->getPixel(0) : NULL;
+}
+
+bool LedStripAdapterAPA102::getPixelFormat(LedStripPixelFormat* format) {
+    *format = LedStripPixelAPA102::getFormat();
+    return true;
+}
+
+uint8_t LedStripAdapterAPA102::getColorChannelCount() {
+    return APA102_COLOR_CHANNEL_COUNT;
+}
+
+uint8_t LedStripAdapterAPA102::getColorValueMax() {
+    return APA102_COLOR_VALUE_MAX;
+}
\ No newline at end of file
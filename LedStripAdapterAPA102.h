@@ -0,0 +1,250 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPADAPTERAPA102_H
+#define LEDSTRIPDRIVER_LEDSTRIPADAPTERAPA102_H
+
+#include "LedStripPort.h"
+#include "LedStripColor.h"
+#include "LedStripAdapterBase.h"
+#include "LedStripPixelAPA102.h"
+
+#define APA102_COLOR_CHANNEL_COUNT 4
+#define APA102_COLOR_VALUE_MAX 255
+
+/**
+ * Default hardware SPI clock in Hz.
+ * APA102 strips take clocks well beyond this, but long unshielded wiring from the Arduino limits the usable rate.
+ */
+#define APA102_SPI_CLOCK_DEFAULT 8000000UL
+
+/**
+ * LED strip adapter for APA102 and SK9822 type LED strips.
+ * The complete frame, including the start and end frames, is kept in a single buffer, so rendering streams it out in
+ * one pass. The 5-bit global brightness of each LED is set through the alpha channel of its color.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripAdapterAPA102 : public LedStripAdapterBase {
+private:
+    /**
+     * Number of LEDs.
+     */
+    uint16_t ledCount;
+
+    /**
+     * Frame buffer, holding the start frame, the native pixels and the end frame.
+     */
+    uint8_t* frame;
+
+    /**
+     * Size of the frame buffer in bytes.
+     */
+    uint32_t frameSize;
+
+    /**
+     * True if the strip is driven by the hardware SPI pins, false if the pins are bit-banged.
+     */
+    bool hardwareSpi;
+
+    /**
+     * Data pin, when bit-banged.
+     */
+    uint8_t pinData;
+
+    /**
+     * Clock pin, when bit-banged.
+     */
+    uint8_t pinClock;
+
+    /**
+     * Hardware SPI clock in Hz.
+     */
+    uint32_t spiClock;
+
+#ifdef LED_STRIP_PORT_REGISTERS
+    /**
+     * Output register of the data pin port, resolved on initialization. NULL if not resolved yet.
+     */
+    LedStripPortReg* dataPort;
+
+    /**
+     * Output register of the clock pin port, resolved on initialization.
+     */
+    LedStripPortReg* clockPort;
+
+    /**
+     * Bit mask of the data pin in its port.
+     */
+    LedStripPortMask dataPinMask;
+
+    /**
+     * Bit mask of the clock pin in its port.
+     */
+    LedStripPortMask clockPinMask;
+#endif
+
+    /**
+     * Time the last frame took to transmit, in microseconds.
+     */
+    unsigned long transmitTime;
+
+    /**
+     * Allocate the frame buffer for the current LED count.
+     * The start and end frames are zeroed, and all LEDs are set to black at full brightness.
+     */
+    void allocate();
+
+    /**
+     * Get the native pixel of the given LED.
+     *
+     * @param ledIndex LED index, must be on the strip.
+     *
+     * @return Native pixel.
+     */
+    uint8_t* getPixel(uint16_t ledIndex);
+
+    /**
+     * Write a color into a native pixel.
+     *
+     * @param pixel Native pixel.
+     * @param redChannel Color value of the red channel.
+     * @param greenChannel Color value of the green channel.
+     * @param blueChannel Color value of the blue channel.
+     * @param alphaChannel Alpha value, used as global brightness.
+     *
+     * @return True if the pixel changed, false if it already had this color.
+     */
+    bool writePixel(uint8_t* pixel, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel,
+                    uint8_t alphaChannel);
+
+    /**
+     * Transmit the frame buffer over the hardware SPI bus.
+     * The bus is claimed for this frame only, so it may be shared with other devices.
+     */
+    void transmitSpi();
+
+    /**
+     * Transmit the frame buffer by bit-banging the data and clock pins.
+     */
+    void transmitBitbang();
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param ledCount Number of LEDs.
+     * @param pinData Data pin.
+     * @param pinClock Clock pin.
+     */
+    LedStripAdapterAPA102(uint16_t ledCount, uint8_t pinData, uint8_t pinClock);
+
+    /**
+     * Constructor, for strips on the hardware SPI pins.
+     * The SPI bus is claimed with these settings for each rendered frame only, so it may be shared with other devices.
+     *
+     * @param ledCount Number of LEDs.
+     * @param spiClock SPI clock in Hz.
+     */
+    LedStripAdapterAPA102(uint16_t ledCount, uint32_t spiClock);
+
+    /**
+     * Destructor.
+     */
+    ~LedStripAdapterAPA102();
+
+    /**
+     * Get the hardware SPI clock.
+     *
+     * @return SPI clock in Hz.
+     */
+    uint32_t getSpiClock();
+
+    /**
+     * Set the hardware SPI clock.
+     * This is applied from the next render, and has no effect on strips driven through arbitrary pins. Cores without SPI
+     * transactions round the clock down to a divider of the CPU clock, and only apply it on init().
+     *
+     * @param spiClock SPI clock in Hz.
+     */
+    void setSpiClock(uint32_t spiClock);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void init();
+
+    // Override virtual method in BaseLedStripAdapter class
+    void init(bool render);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void render();
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint16_t getLedCount();
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedCount(uint16_t ledCount);
+
+    // Override virtual method in BaseLedStripAdapter class
+    LedStripColor getLedColor(uint16_t ledIndex);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, LedStripColor color);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel, uint8_t alphaChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint32_t getLedColorCombinedChannels(uint16_t ledIndex);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColorCombinedChannels(uint16_t ledIndex, uint32_t combinedColorValue);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColors(uint16_t fromLedIndex, LedStripColor* colors, uint16_t count);
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint32_t getTransferRate();
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint8_t* getNativePixels();
+
+    // Override virtual method in BaseLedStripAdapter class
+    bool getPixelFormat(LedStripPixelFormat* format);
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint8_t getColorChannelCount();
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint8_t getColorValueMax();
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPADAPTERAPA102_H
\ No newline at end of file
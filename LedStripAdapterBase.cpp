@@ -22,6 +22,74 @@
 
 #include "LedStripAdapterBase.h"
 
+LedStripAdapterBase::LedStripAdapterBase() {
+    this->dirtyFromLedIndex = 0;
+    this->dirtyToLedIndex = 0;
+    this->dirtyLedCount = 0;
+    this->renderedLedCount = 0;
+}
+
+LedStripAdapterBase::~LedStripAdapterBase() { }
+
+void LedStripAdapterBase::markDirty(uint16_t fromLedIndex, uint16_t toLedIndex, uint16_t changedLedCount) {
+    // Ignore empty ranges
+    if(toLedIndex <= fromLedIndex)
+        return;
+
+    // Set or grow the dirty range, subclasses may report changes outside of it
+    if(!LedStripAdapterBase::isDirty()) {
+        this->dirtyFromLedIndex = fromLedIndex;
+        this->dirtyToLedIndex = toLedIndex;
+    } else {
+        if(fromLedIndex < this->dirtyFromLedIndex)
+            this->dirtyFromLedIndex = fromLedIndex;
+        if(toLedIndex > this->dirtyToLedIndex)
+            this->dirtyToLedIndex = toLedIndex;
+    }
+
+    // Count the changed LEDs
+    this->dirtyLedCount += changedLedCount;
+}
+
+void LedStripAdapterBase::markRendered() {
+    // Report the number of changes in this frame, and reset the dirty range
+    this->renderedLedCount = this->dirtyLedCount;
+    this->dirtyFromLedIndex = 0;
+    this->dirtyToLedIndex = 0;
+    this->dirtyLedCount = 0;
+}
+
+void LedStripAdapterBase::setLedColors(uint16_t fromLedIndex, LedStripColor* colors, uint16_t count) {
+    // Loop through the buffer to set the values
+    for(uint16_t i = 0; i < count; i++)
+        this->setLedColor(fromLedIndex + i, colors[i]);
+}
+
+void LedStripAdapterBase::setLedColorsCombinedChannels(uint16_t fromLedIndex, uint32_t* combinedColorValues,
+                                                       uint16_t count) {
+    // Loop through the buffer to set the values
+    for(uint16_t i = 0; i < count; i++)
+        this->setLedColorCombinedChannels(fromLedIndex + i, combinedColorValues[i]);
+}
+
+void LedStripAdapterBase::setRangeLedColorsFromWheel(uint16_t fromLedIndex, uint16_t toLedIndex, uint16_t position,
+                                                     uint32_t stride) {
+    // Buffer for a chunk of colors
+    LedStripColor colors[LED_STRIP_ADAPTER_CHUNK_SIZE];
+
+    // Walk the range in chunks, and write each chunk in bulk
+    // The index is only advanced by the chunk count, and never past the end of the range, so it can't wrap around
+    uint32_t wheelPosition = (uint32_t) position * LED_STRIP_COLOR_WHEEL_STEP;
+    uint16_t i = fromLedIndex;
+    while(i < toLedIndex) {
+        uint16_t count = toLedIndex - i < LED_STRIP_ADAPTER_CHUNK_SIZE ? toLedIndex - i : LED_STRIP_ADAPTER_CHUNK_SIZE;
+        LedStripColor::fillWheel(colors, count, wheelPosition, stride);
+        this->setLedColors(i, colors, count);
+        wheelPosition += stride * count;
+        i += count;
+    }
+}
+
 void LedStripAdapterBase::setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, LedStripColor color) {
     // Loop through the LED range to set the values
     for(uint16_t i = fromLedIndex; i < toLedIndex; i++)
@@ -91,6 +159,64 @@ void LedStripAdapterBase::setAllLedColorsCombinedChannels(uint32_t combinedColor
     this->setRangeLedColorsCombinedChannels(0, this->getLedCount(), combinedColorValue);
 }
 
+void LedStripAdapterBase::renderAsync() {
+    this->render();
+}
+
+bool LedStripAdapterBase::isRenderComplete() {
+    return true;
+}
+
+void LedStripAdapterBase::present() {
+    this->renderAsync();
+}
+
+uint32_t LedStripAdapterBase::getTransferRate() {
+    return 0;
+}
+
+uint8_t* LedStripAdapterBase::getNativePixels() {
+    return NULL;
+}
+
+bool LedStripAdapterBase::getPixelFormat(LedStripPixelFormat*) {
+    return false;
+}
+
+void LedStripAdapterBase::markNativePixelsChanged(uint16_t fromLedIndex, uint16_t toLedIndex) {
+    // Clip the range to the strip
+    if(toLedIndex > this->getLedCount())
+        toLedIndex = this->getLedCount();
+    if(fromLedIndex >= toLedIndex)
+        return;
+
+    this->markDirty(fromLedIndex, toLedIndex, toLedIndex - fromLedIndex);
+}
+
+bool LedStripAdapterBase::isDirty() {
+    return this->dirtyToLedIndex > this->dirtyFromLedIndex;
+}
+
+uint16_t LedStripAdapterBase::getDirtyFromLedIndex() {
+    return this->dirtyFromLedIndex;
+}
+
+uint16_t LedStripAdapterBase::getDirtyToLedIndex() {
+    return this->dirtyToLedIndex;
+}
+
+uint16_t LedStripAdapterBase::getDirtyLedCount() {
+    return this->dirtyLedCount;
+}
+
+uint16_t LedStripAdapterBase::getRenderedLedCount() {
+    return this->renderedLedCount;
+}
+
+void LedStripAdapterBase::invalidate() {
+    this->markDirty(0, this->getLedCount(), this->getLedCount());
+}
+
 bool LedStripAdapterBase::hasRedChannelSupport() {
     return this->getColorChannelCount() >= 1;
 }
@@ -105,4 +231,8 @@ bool LedStripAdapterBase::hasBlueChannelSupport() {
 
 bool LedStripAdapterBase::hasAlphaChannelSupport() {
     return this->getColorChannelCount() >= 4;
+}
+
+bool LedStripAdapterBase::hasWhiteChannelSupport() {
+    return false;
 }
\ No newline at end of file
@@ -24,6 +24,9 @@
 #define LEDSTRIPDRIVER_BASELEDSTRIPADAPTER_H
 
 #include "LedStripColor.h"
+#include "LedStripPixelFormat.h"
+
+#define LED_STRIP_ADAPTER_CHUNK_SIZE 16
 
 /**
  * LED strip adapter base class.
@@ -33,7 +36,56 @@
  * @website http://timvisee/
  */
 class LedStripAdapterBase {
+private:
+    /**
+     * First LED index of the range changed since the last render.
+     */
+    uint16_t dirtyFromLedIndex;
+
+    /**
+     * Last LED index (excluded) of the range changed since the last render.
+     * The range is empty if this equals the from index.
+     */
+    uint16_t dirtyToLedIndex;
+
+    /**
+     * Number of LED writes that changed the strip state since the last render.
+     */
+    uint16_t dirtyLedCount;
+
+    /**
+     * Number of LED writes that changed the strip state in the last rendered frame.
+     */
+    uint16_t renderedLedCount;
+
+protected:
+    /**
+     * Constructor.
+     */
+    LedStripAdapterBase();
+
+    /**
+     * Mark the given range of LEDs as changed since the last render.
+     * Adapters must call this whenever a write actually changes the state of the LED strip.
+     *
+     * @param fromLedIndex From LED index.
+     * @param toLedIndex To LED index. (excluded)
+     * @param changedLedCount Number of LEDs that were changed in the range.
+     */
+    void markDirty(uint16_t fromLedIndex, uint16_t toLedIndex, uint16_t changedLedCount);
+
+    /**
+     * Mark the state of the LED strip as rendered.
+     * Adapters must call this when a frame is rendered.
+     */
+    void markRendered();
+
 public:
+    /**
+     * Destructor.
+     */
+    virtual ~LedStripAdapterBase();
+
     /**
      * Initialize the LED strip.
      * Required before it's used.
@@ -54,6 +106,27 @@ public:
      */
     virtual void render() = 0;
 
+    /**
+     * Start rendering the state of the LED strip to the physical hardware, without waiting for it to complete.
+     * LED colors must not be changed until isRenderComplete() returns true, or the change may end up in the frame.
+     * Adapters that can't transfer in the background render synchronously, which is the default.
+     */
+    virtual void renderAsync();
+
+    /**
+     * Check whether the last render has been transferred to the physical hardware.
+     *
+     * @return True if complete, false if a background render is still in progress.
+     */
+    virtual bool isRenderComplete();
+
+    /**
+     * Present the drawn state of the LED strip, rendering it in the background.
+     * Adapters with double buffering enabled swap buffers, so drawing may continue immediately without affecting the
+     * presented frame. Otherwise this is the same as renderAsync(), which is the default.
+     */
+    virtual void present();
+
     /**
      * Get the number of LEDs controlled by this LED strip adapter.
      *
@@ -138,6 +211,40 @@ public:
      */
     virtual void setLedColorCombinedChannels(uint16_t ledIndex, uint32_t combinedColorValue) = 0;
 
+    /**
+     * Set the colors of a span of LEDs on the strip from a contiguous buffer of colors.
+     * The first color is written to the LED at the given index, the next color to the LED after it, and so on.
+     * LEDs beyond the end of the strip are ignored.
+     *
+     * @param fromLedIndex Index of the first LED to configure.
+     * @param colors Buffer of LED colors.
+     * @param count Number of colors in the buffer.
+     */
+    virtual void setLedColors(uint16_t fromLedIndex, LedStripColor* colors, uint16_t count);
+
+    /**
+     * Set the colors of a span of LEDs on the strip from a contiguous buffer of combined color values.
+     * The first value is written to the LED at the given index, the next value to the LED after it, and so on.
+     * LEDs beyond the end of the strip are ignored.
+     *
+     * @param fromLedIndex Index of the first LED to configure.
+     * @param combinedColorValues Buffer of combined color values.
+     * @param count Number of values in the buffer.
+     */
+    virtual void setLedColorsCombinedChannels(uint16_t fromLedIndex, uint32_t* combinedColorValues, uint16_t count);
+
+    /**
+     * Set the color of the LEDs in the given range on the strip from a color wheel.
+     * Each next LED is a fixed stride further along the wheel, see LedStripColor::fillWheel().
+     *
+     * @param fromLedIndex From LED index.
+     * @param toLedIndex To LED index. (excluded)
+     * @param position Color wheel position of the first LED.
+     * @param stride Color wheel distance between two LEDs, in steps. (LED_STRIP_COLOR_WHEEL_STEP for one position)
+     */
+    virtual void setRangeLedColorsFromWheel(uint16_t fromLedIndex, uint16_t toLedIndex, uint16_t position,
+                                            uint32_t stride);
+
     /**
      * Set the color of the LEDs in the given range on the strip.
      *
@@ -253,6 +360,81 @@ public:
      */
     virtual void setAllLedColorsCombinedChannels(uint32_t combinedColorValue);
 
+    /**
+     * Get the throughput of the last completed transfer to the physical hardware.
+     *
+     * @return Bytes per second, or 0 if unknown.
+     */
+    virtual uint32_t getTransferRate();
+
+    /**
+     * Get the native pixel buffer of this LED strip, if the adapter exposes it.
+     * Pixels may be written in the format described by getPixelFormat(), which skips the color translation of the
+     * regular setters, including any color correction. Call markNativePixelsChanged() after writing.
+     *
+     * @return Native pixel buffer, or NULL if not supported.
+     */
+    virtual uint8_t* getNativePixels();
+
+    /**
+     * Get the format of the native pixel buffer.
+     *
+     * @param format Format to fill.
+     *
+     * @return True if the adapter exposes a native pixel buffer, false if not.
+     */
+    virtual bool getPixelFormat(LedStripPixelFormat* format);
+
+    /**
+     * Mark the given range of LEDs as changed, after writing to the native pixel buffer directly.
+     *
+     * @param fromLedIndex From LED index.
+     * @param toLedIndex To LED index. (excluded)
+     */
+    virtual void markNativePixelsChanged(uint16_t fromLedIndex, uint16_t toLedIndex);
+
+    /**
+     * Check whether the state of the LED strip has changed since the last render.
+     * Rendering is skipped if nothing has changed.
+     *
+     * @return True if changed, false if not.
+     */
+    virtual bool isDirty();
+
+    /**
+     * Get the first LED index of the range changed since the last render.
+     *
+     * @return From LED index.
+     */
+    uint16_t getDirtyFromLedIndex();
+
+    /**
+     * Get the last LED index of the range changed since the last render.
+     *
+     * @return To LED index. (excluded)
+     */
+    uint16_t getDirtyToLedIndex();
+
+    /**
+     * Get the number of LED writes that changed the strip state since the last render.
+     *
+     * @return Changed LED count.
+     */
+    uint16_t getDirtyLedCount();
+
+    /**
+     * Get the number of LED writes that changed the strip state in the last rendered frame.
+     * This may be used to throttle rendering.
+     *
+     * @return Changed LED count.
+     */
+    uint16_t getRenderedLedCount();
+
+    /**
+     * Mark all LEDs as changed, to force the next render to output the full strip state.
+     */
+    virtual void invalidate();
+
     /**
      * Get the number of color channels this LED strip has.
      */
@@ -290,6 +472,14 @@ public:
      * @return True if this LED strip has support, false if not.
      */
     bool hasAlphaChannelSupport();
+
+    /**
+     * Check whether this LED strip has a separate white emitter on each LED.
+     * The white channel isn't part of LedStripColor, and is set through the adapter of such strips.
+     *
+     * @return True if this LED strip has support, false if not.
+     */
+    virtual bool hasWhiteChannelSupport();
 };
 
 #endif // LEDSTRIPDRIVER_BASELEDSTRIPADAPTER_H
@@ -0,0 +1,371 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripAdapterGroup.h"
+
+LedStripAdapterGroup::LedStripAdapterGroup(uint8_t stripCapacity) {
+    // Set the fields
+    this->stripCapacity = stripCapacity;
+    this->stripCount = 0;
+    this->ledCount = 0;
+
+    // Allocate the strip lists
+    this->strips = new LedStripBase*[stripCapacity];
+    this->offsets = new uint16_t[stripCapacity];
+    this->parallelAdapters = new LedStripAdapterLPD8806*[stripCapacity];
+}
+
+LedStripAdapterGroup::~LedStripAdapterGroup() {
+    // Explicitly delete the dynamically allocated strip lists, the strips themselves aren't owned
+    delete[] this->strips;
+    delete[] this->offsets;
+    delete[] this->parallelAdapters;
+}
+
+bool LedStripAdapterGroup::addStrip(LedStripBase* strip, LedStripAdapterLPD8806* parallelAdapter) {
+    // Make sure there's room for the strip
+    if(this->stripCount >= this->stripCapacity)
+        return false;
+
+    // Append the strip to the logical index space
+    this->strips[this->stripCount] = strip;
+    this->offsets[this->stripCount] = this->ledCount;
+    this->parallelAdapters[this->stripCount] = parallelAdapter;
+    this->stripCount++;
+    this->ledCount += strip->getLedCount();
+
+    // Make sure the new strip is rendered
+    strip->getAdapter()->invalidate();
+    return true;
+}
+
+uint8_t LedStripAdapterGroup::getStripCount() {
+    return this->stripCount;
+}
+
+LedStripBase* LedStripAdapterGroup::getStrip(uint8_t stripIndex) {
+    return stripIndex < this->stripCount ? this->strips[stripIndex] : NULL;
+}
+
+uint16_t LedStripAdapterGroup::getStripOffset(uint8_t stripIndex) {
+    return stripIndex < this->stripCount ? this->offsets[stripIndex] : this->ledCount;
+}
+
+uint8_t LedStripAdapterGroup::findStrip(uint16_t ledIndex) {
+    // Walk the strips backwards, to find the last one starting at or before the LED
+    if(ledIndex >= this->ledCount)
+        return this->stripCount;
+    uint8_t stripIndex = this->stripCount - 1;
+    while(this->offsets[stripIndex] > ledIndex)
+        stripIndex--;
+    return stripIndex;
+}
+
+void LedStripAdapterGroup::markStripDirty(uint8_t stripIndex, uint16_t fromLedIndex, uint16_t toLedIndex,
+                                          uint16_t dirtyLedCount) {
+    // Only mark the range if the strip counted changed LEDs since the count was taken, unchanged writes are skipped
+    uint16_t changedLedCount = this->strips[stripIndex]->getAdapter()->getDirtyLedCount() - dirtyLedCount;
+    if(changedLedCount > 0)
+        this->markDirty(this->offsets[stripIndex] + fromLedIndex, this->offsets[stripIndex] + toLedIndex,
+                        changedLedCount);
+}
+
+bool LedStripAdapterGroup::clipRange(uint8_t stripIndex, uint16_t fromLedIndex, uint16_t toLedIndex,
+                                     uint16_t* stripFromLedIndex, uint16_t* stripToLedIndex) {
+    // Determine the bounds of the strip
+    uint16_t stripFrom = this->offsets[stripIndex];
+    uint16_t stripTo = stripFrom + this->strips[stripIndex]->getLedCount();
+
+    // Intersect the range with the strip
+    if(fromLedIndex < stripFrom)
+        fromLedIndex = stripFrom;
+    if(toLedIndex > stripTo)
+        toLedIndex = stripTo;
+    if(toLedIndex <= fromLedIndex)
+        return false;
+
+    *stripFromLedIndex = fromLedIndex - stripFrom;
+    *stripToLedIndex = toLedIndex - stripFrom;
+    return true;
+}
+
+void LedStripAdapterGroup::init() {
+    // Initialize all strips, without rendering them one by one
+    for(uint8_t i = 0; i < this->stripCount; i++)
+        this->strips[i]->getAdapter()->init(false);
+}
+
+void LedStripAdapterGroup::init(bool render) {
+    // Initialize all strips
+    this->init();
+
+    // Render the LED strips
+    if(render)
+        this->render();
+}
+
+void LedStripAdapterGroup::render() {
+    // Render the LPD8806 strips together, and the other strips one by one
+    // Each strip skips rendering on its own if it hasn't changed, which also covers writes made to it directly
+    LedStripAdapterLPD8806::renderParallel(this->parallelAdapters, this->stripCount);
+    for(uint8_t i = 0; i < this->stripCount; i++)
+        if(this->parallelAdapters[i] == NULL)
+            this->strips[i]->render();
+    this->markRendered();
+}
+
+bool LedStripAdapterGroup::isRenderComplete() {
+    // The render is complete once it is complete on all strips
+    for(uint8_t i = 0; i < this->stripCount; i++)
+        if(!this->strips[i]->isRenderComplete())
+            return false;
+    return true;
+}
+
+bool LedStripAdapterGroup::isDirty() {
+    // The group is changed if it was written, or if any of its strips was written directly
+    if(LedStripAdapterBase::isDirty())
+        return true;
+    for(uint8_t i = 0; i < this->stripCount; i++)
+        if(this->strips[i]->getAdapter()->isDirty())
+            return true;
+    return false;
+}
+
+void LedStripAdapterGroup::invalidate() {
+    // The strips skip rendering on their own, so they must be invalidated as well
+    LedStripAdapterBase::invalidate();
+    for(uint8_t i = 0; i < this->stripCount; i++)
+        this->strips[i]->getAdapter()->invalidate();
+}
+
+uint16_t LedStripAdapterGroup::getLedCount() {
+    return this->ledCount;
+}
+
+void LedStripAdapterGroup::setLedCount(uint16_t) { }
+
+LedStripColor LedStripAdapterGroup::getLedColor(uint16_t ledIndex) {
+    // Make sure the LED is on a strip
+    uint8_t stripIndex = this->findStrip(ledIndex);
+    if(stripIndex >= this->stripCount)
+        return LedStripColor::black();
+
+    return this->strips[stripIndex]->getAdapter()->getLedColor(ledIndex - this->offsets[stripIndex]);
+}
+
+void LedStripAdapterGroup::setLedColor(uint16_t ledIndex, LedStripColor color) {
+    uint8_t stripIndex = this->findStrip(ledIndex);
+    if(stripIndex >= this->stripCount)
+        return;
+
+    // Write the LED on its strip, and mark it only if the strip reports a change
+    LedStripAdapterBase* adapter = this->strips[stripIndex]->getAdapter();
+    uint16_t dirtyLedCount = adapter->getDirtyLedCount();
+    uint16_t stripLedIndex = ledIndex - this->offsets[stripIndex];
+    adapter->setLedColor(stripLedIndex, color);
+    this->markStripDirty(stripIndex, stripLedIndex, stripLedIndex + 1, dirtyLedCount);
+}
+
+void LedStripAdapterGroup::setLedColor(uint16_t ledIndex, uint8_t redChannel) {
+    uint8_t stripIndex = this->findStrip(ledIndex);
+    if(stripIndex >= this->stripCount)
+        return;
+
+    // Write the LED on its strip, and mark it only if the strip reports a change
+    LedStripAdapterBase* adapter = this->strips[stripIndex]->getAdapter();
+    uint16_t dirtyLedCount = adapter->getDirtyLedCount();
+    uint16_t stripLedIndex = ledIndex - this->offsets[stripIndex];
+    adapter->setLedColor(stripLedIndex, redChannel);
+    this->markStripDirty(stripIndex, stripLedIndex, stripLedIndex + 1, dirtyLedCount);
+}
+
+void LedStripAdapterGroup::setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel) {
+    uint8_t stripIndex = this->findStrip(ledIndex);
+    if(stripIndex >= this->stripCount)
+        return;
+
+    // Write the LED on its strip, and mark it only if the strip reports a change
+    LedStripAdapterBase* adapter = this->strips[stripIndex]->getAdapter();
+    uint16_t dirtyLedCount = adapter->getDirtyLedCount();
+    uint16_t stripLedIndex = ledIndex - this->offsets[stripIndex];
+    adapter->setLedColor(stripLedIndex, redChannel, greenChannel);
+    this->markStripDirty(stripIndex, stripLedIndex, stripLedIndex + 1, dirtyLedCount);
+}
+
+void LedStripAdapterGroup::setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel,
+                                       uint8_t blueChannel) {
+    uint8_t stripIndex = this->findStrip(ledIndex);
+    if(stripIndex >= this->stripCount)
+        return;
+
+    // Write the LED on its strip, and mark it only if the strip reports a change
+    LedStripAdapterBase* adapter = this->strips[stripIndex]->getAdapter();
+    uint16_t dirtyLedCount = adapter->getDirtyLedCount();
+    uint16_t stripLedIndex = ledIndex - this->offsets[stripIndex];
+    adapter->setLedColor(stripLedIndex, redChannel, greenChannel, blueChannel);
+    this->markStripDirty(stripIndex, stripLedIndex, stripLedIndex + 1, dirtyLedCount);
+}
+
+void LedStripAdapterGroup::setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel,
+                                       uint8_t blueChannel, uint8_t alphaChannel) {
+    uint8_t stripIndex = this->findStrip(ledIndex);
+    if(stripIndex >= this->stripCount)
+        return;
+
+    // Write the LED on its strip, and mark it only if the strip reports a change
+    LedStripAdapterBase* adapter = this->strips[stripIndex]->getAdapter();
+    uint16_t dirtyLedCount = adapter->getDirtyLedCount();
+    uint16_t stripLedIndex = ledIndex - this->offsets[stripIndex];
+    adapter->setLedColor(stripLedIndex, redChannel, greenChannel, blueChannel, alphaChannel);
+    this->markStripDirty(stripIndex, stripLedIndex, stripLedIndex + 1, dirtyLedCount);
+}
+
+uint32_t LedStripAdapterGroup::getLedColorCombinedChannels(uint16_t ledIndex) {
+    // Make sure the LED is on a strip
+    uint8_t stripIndex = this->findStrip(ledIndex);
+    if(stripIndex >= this->stripCount)
+        return 0;
+
+    return this->strips[stripIndex]->getAdapter()->getLedColorCombinedChannels(ledIndex - this->offsets[stripIndex]);
+}
+
+void LedStripAdapterGroup::setLedColorCombinedChannels(uint16_t ledIndex, uint32_t combinedColorValue) {
+    uint8_t stripIndex = this->findStrip(ledIndex);
+    if(stripIndex >= this->stripCount)
+        return;
+
+    // Write the LED on its strip, and mark it only if the strip reports a change
+    LedStripAdapterBase* adapter = this->strips[stripIndex]->getAdapter();
+    uint16_t dirtyLedCount = adapter->getDirtyLedCount();
+    uint16_t stripLedIndex = ledIndex - this->offsets[stripIndex];
+    adapter->setLedColorCombinedChannels(stripLedIndex, combinedColorValue);
+    this->markStripDirty(stripIndex, stripLedIndex, stripLedIndex + 1, dirtyLedCount);
+}
+
+void LedStripAdapterGroup::setLedColors(uint16_t fromLedIndex, LedStripColor* colors, uint16_t count) {
+    // Split the span into one bulk write per strip, the end is clamped as the sum may overflow
+    if(fromLedIndex >= this->ledCount)
+        return;
+    uint16_t toLedIndex = count > this->ledCount - fromLedIndex ? this->ledCount : fromLedIndex + count;
+    uint16_t stripFrom, stripTo;
+    for(uint8_t i = 0; i < this->stripCount; i++) {
+        if(!this->clipRange(i, fromLedIndex, toLedIndex, &stripFrom, &stripTo))
+            continue;
+        uint16_t dirtyLedCount = this->strips[i]->getAdapter()->getDirtyLedCount();
+        this->strips[i]->getAdapter()->setLedColors(
+                stripFrom, colors + (this->offsets[i] + stripFrom - fromLedIndex), stripTo - stripFrom);
+        this->markStripDirty(i, stripFrom, stripTo, dirtyLedCount);
+    }
+}
+
+void LedStripAdapterGroup::setLedColorsCombinedChannels(uint16_t fromLedIndex, uint32_t* combinedColorValues,
+                                                        uint16_t count) {
+    // Split the span into one bulk write per strip, the end is clamped as the sum may overflow
+    if(fromLedIndex >= this->ledCount)
+        return;
+    uint16_t toLedIndex = count > this->ledCount - fromLedIndex ? this->ledCount : fromLedIndex + count;
+    uint16_t stripFrom, stripTo;
+    for(uint8_t i = 0; i < this->stripCount; i++) {
+        if(!this->clipRange(i, fromLedIndex, toLedIndex, &stripFrom, &stripTo))
+            continue;
+        uint16_t dirtyLedCount = this->strips[i]->getAdapter()->getDirtyLedCount();
+        this->strips[i]->getAdapter()->setLedColorsCombinedChannels(
+                stripFrom, combinedColorValues + (this->offsets[i] + stripFrom - fromLedIndex), stripTo - stripFrom);
+        this->markStripDirty(i, stripFrom, stripTo, dirtyLedCount);
+    }
+}
+
+void LedStripAdapterGroup::setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, LedStripColor color) {
+    // Split the range into one range write per strip
+    uint16_t stripFrom, stripTo;
+    for(uint8_t i = 0; i < this->stripCount; i++) {
+        if(!this->clipRange(i, fromLedIndex, toLedIndex, &stripFrom, &stripTo))
+            continue;
+        uint16_t dirtyLedCount = this->strips[i]->getAdapter()->getDirtyLedCount();
+        this->strips[i]->getAdapter()->setRangeLedColors(stripFrom, stripTo, color);
+        this->markStripDirty(i, stripFrom, stripTo, dirtyLedCount);
+    }
+}
+
+void LedStripAdapterGroup::setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, uint8_t redChannel,
+                                             uint8_t greenChannel, uint8_t blueChannel) {
+    // Split the range into one range write per strip
+    uint16_t stripFrom, stripTo;
+    for(uint8_t i = 0; i < this->stripCount; i++) {
+        if(!this->clipRange(i, fromLedIndex, toLedIndex, &stripFrom, &stripTo))
+            continue;
+        uint16_t dirtyLedCount = this->strips[i]->getAdapter()->getDirtyLedCount();
+        this->strips[i]->getAdapter()->setRangeLedColors(stripFrom, stripTo, redChannel, greenChannel,
+                                                          blueChannel);
+        this->markStripDirty(i, stripFrom, stripTo, dirtyLedCount);
+    }
+}
+
+void LedStripAdapterGroup::setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, uint8_t redChannel,
+                                             uint8_t greenChannel, uint8_t blueChannel, uint8_t alphaChannel) {
+    // Split the range into one range write per strip
+    uint16_t stripFrom, stripTo;
+    for(uint8_t i = 0; i < this->stripCount; i++) {
+        if(!this->clipRange(i, fromLedIndex, toLedIndex, &stripFrom, &stripTo))
+            continue;
+        uint16_t dirtyLedCount = this->strips[i]->getAdapter()->getDirtyLedCount();
+        this->strips[i]->getAdapter()->setRangeLedColors(stripFrom, stripTo, redChannel, greenChannel,
+                                                          blueChannel, alphaChannel);
+        this->markStripDirty(i, stripFrom, stripTo, dirtyLedCount);
+    }
+}
+
+void LedStripAdapterGroup::setRangeLedColorsCombinedChannels(uint16_t fromLedIndex, uint16_t toLedIndex,
+                                                             uint32_t combinedColorValue) {
+    // Split the range into one range write per strip
+    uint16_t stripFrom, stripTo;
+    for(uint8_t i = 0; i < this->stripCount; i++) {
+        if(!this->clipRange(i, fromLedIndex, toLedIndex, &stripFrom, &stripTo))
+            continue;
+        uint16_t dirtyLedCount = this->strips[i]->getAdapter()->getDirtyLedCount();
+        this->strips[i]->getAdapter()->setRangeLedColorsCombinedChannels(stripFrom, stripTo, combinedColorValue);
+        this->markStripDirty(i, stripFrom, stripTo, dirtyLedCount);
+    }
+}
+
+uint8_t LedStripAdapterGroup::getColorChannelCount() {
+    // Only the channels all strips have are usable
+    uint8_t channelCount = 0;
+    for(uint8_t i = 0; i < this->stripCount; i++) {
+        uint8_t stripChannelCount = this->strips[i]->getAdapter()->getColorChannelCount();
+        if(i == 0 || stripChannelCount < channelCount)
+            channelCount = stripChannelCount;
+    }
+    return channelCount;
+}
+
+uint8_t LedStripAdapterGroup::getColorValueMax() {
+    // Only the values all strips support are usable
+    uint8_t valueMax = 0;
+    for(uint8_t i = 0; i < this->stripCount; i++) {
+        uint8_t stripValueMax = this->strips[i]->getAdapter()->getColorValueMax();
+        if(i == 0 || stripValueMax < valueMax)
+            valueMax = stripValueMax;
+    }
+    return valueMax;
+}
\ No newline at end of file
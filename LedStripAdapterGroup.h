@@ -0,0 +1,247 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPADAPTERGROUP_H
+#define LEDSTRIPDRIVER_LEDSTRIPADAPTERGROUP_H
+
+#include "LedStripColor.h"
+#include "LedStripAdapterBase.h"
+#include "LedStripAdapterLPD8806.h"
+#include "LedStripBase.h"
+
+/**
+ * LED strip adapter for a group of LED strips.
+ * The LEDs of the strips follow each other in one logical index space, in the order the strips were added.
+ * Writes are forwarded to the strip each LED is on, and ranges are split into one bulk write per strip.
+ * The strips aren't owned by the group, and must outlive it.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripAdapterGroup : public LedStripAdapterBase {
+private:
+    /**
+     * Strips in this group.
+     */
+    LedStripBase** strips;
+
+    /**
+     * Logical index of the first LED of each strip.
+     */
+    uint16_t* offsets;
+
+    /**
+     * LPD8806 adapter of each strip that may be rendered in parallel, NULL for other strips.
+     */
+    LedStripAdapterLPD8806** parallelAdapters;
+
+    /**
+     * Maximum number of strips.
+     */
+    uint8_t stripCapacity;
+
+    /**
+     * Number of strips.
+     */
+    uint8_t stripCount;
+
+    /**
+     * Total number of LEDs.
+     */
+    uint16_t ledCount;
+
+    /**
+     * Find the strip the given LED is on.
+     *
+     * @param ledIndex Logical LED index.
+     *
+     * @return Strip index, or the strip count if the LED isn't on any strip.
+     */
+    uint8_t findStrip(uint16_t ledIndex);
+
+    /**
+     * Clip a logical LED range to the given strip.
+     *
+     * @param stripIndex Strip index.
+     * @param fromLedIndex Logical from LED index.
+     * @param toLedIndex Logical to LED index. (excluded)
+     * @param stripFromLedIndex Returns the from LED index on the strip.
+     * @param stripToLedIndex Returns the to LED index on the strip. (excluded)
+     *
+     * @return True if part of the range is on the strip, false if not.
+     */
+    bool clipRange(uint8_t stripIndex, uint16_t fromLedIndex, uint16_t toLedIndex,
+                   uint16_t* stripFromLedIndex, uint16_t* stripToLedIndex);
+
+    /**
+     * Mark a range of a strip as dirty on the group, if the strip counted changed LEDs since the given count.
+     * The strips compare the written colors, so writes that don't change anything don't mark the group either.
+     *
+     * @param stripIndex Strip index.
+     * @param fromLedIndex From LED index on the strip.
+     * @param toLedIndex To LED index on the strip. (excluded)
+     * @param dirtyLedCount Dirty LED count of the strip before the write.
+     */
+    void markStripDirty(uint8_t stripIndex, uint16_t fromLedIndex, uint16_t toLedIndex, uint16_t dirtyLedCount);
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param stripCapacity Maximum number of strips in the group.
+     */
+    LedStripAdapterGroup(uint8_t stripCapacity);
+
+    /**
+     * Destructor.
+     */
+    ~LedStripAdapterGroup();
+
+    /**
+     * Add a strip to the end of the group.
+     *
+     * @param strip LED strip.
+     * @param parallelAdapter LPD8806 adapter of the strip to render it in parallel with other LPD8806 strips,
+     *                        or NULL to render the strip on its own.
+     *
+     * @return True if the strip was added, false if the group is full.
+     */
+    bool addStrip(LedStripBase* strip, LedStripAdapterLPD8806* parallelAdapter);
+
+    /**
+     * Get the number of strips in the group.
+     *
+     * @return Strip count.
+     */
+    uint8_t getStripCount();
+
+    /**
+     * Get a strip in the group.
+     *
+     * @param stripIndex Strip index.
+     *
+     * @return LED strip, or NULL if the index is out of range.
+     */
+    LedStripBase* getStrip(uint8_t stripIndex);
+
+    /**
+     * Get the logical index of the first LED of a strip in the group.
+     *
+     * @param stripIndex Strip index.
+     *
+     * @return Logical LED index.
+     */
+    uint16_t getStripOffset(uint8_t stripIndex);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void init();
+
+    // Override virtual method in BaseLedStripAdapter class
+    void init(bool render);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void render();
+
+    // Override virtual method in BaseLedStripAdapter class
+    bool isRenderComplete();
+
+    /**
+     * Check whether the state of the group has changed since the last render.
+     * Besides writes through the group, this includes writes made to one of its strips directly.
+     *
+     * @return True if changed, false if not.
+     */
+    bool isDirty();
+
+    /**
+     * Mark all LEDs of the group and its strips as changed, to force the next render to output all strips.
+     */
+    void invalidate();
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint16_t getLedCount();
+
+    /**
+     * The LED count of a group follows from its strips, so this has no effect.
+     */
+    void setLedCount(uint16_t);
+
+    // Override virtual method in BaseLedStripAdapter class
+    LedStripColor getLedColor(uint16_t ledIndex);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, LedStripColor color);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel, uint8_t alphaChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint32_t getLedColorCombinedChannels(uint16_t ledIndex);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColorCombinedChannels(uint16_t ledIndex, uint32_t combinedColorValue);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColors(uint16_t fromLedIndex, LedStripColor* colors, uint16_t count);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColorsCombinedChannels(uint16_t fromLedIndex, uint32_t* combinedColorValues, uint16_t count);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, LedStripColor color);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, uint8_t redChannel, uint8_t greenChannel,
+                           uint8_t blueChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, uint8_t redChannel, uint8_t greenChannel,
+                           uint8_t blueChannel, uint8_t alphaChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setRangeLedColorsCombinedChannels(uint16_t fromLedIndex, uint16_t toLedIndex, uint32_t combinedColorValue);
+
+    /**
+     * Get the number of color channels all strips in the group have.
+     *
+     * @return Lowest color channel count of the strips.
+     */
+    uint8_t getColorChannelCount();
+
+    /**
+     * Get the maximum color value all strips in the group support.
+     *
+     * @return Lowest maximum color value of the strips.
+     */
+    uint8_t getColorValueMax();
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPADAPTERGROUP_H
\ No newline at end of file
@@ -24,12 +24,189 @@
 
 LedStripAdapterLPD8806::LedStripAdapterLPD8806(uint16_t ledCount, uint8_t pinData, uint8_t pinClock) {
     // Initialize the LED strip
-    strip = new LPD8806(ledCount, pinData, pinClock);
+    this->attachStrip(new LPD8806(ledCount, pinData, pinClock));
+}
+
+LedStripAdapterLPD8806::LedStripAdapterLPD8806(uint16_t ledCount, uint32_t spiClock) {
+    // Initialize the LED strip on the hardware SPI pins
+    this->attachStrip(new LPD8806(ledCount, spiClock));
+}
+
+void LedStripAdapterLPD8806::attachStrip(LPD8806* strip) {
+    // Set the LED strip
+    this->strip = strip;
+
+    // No color correction by default
+    this->gamma = 1.0f;
+    this->brightness = LED_STRIP_COLOR_VALUE_MAX;
+    for(uint8_t channel = 0; channel < LPD8806_COLOR_CHANNEL_COUNT; channel++)
+        this->channelScale[channel] = LED_STRIP_COLOR_VALUE_MAX;
+    this->colorTable = NULL;
+    this->ditherBits = NULL;
+    this->presentKeepsContents = true;
+    this->powerBudget = NULL;
+    this->powerBudgetStale = false;
+
+    // The hardware state is unknown, make sure the first render outputs everything
+    this->invalidate();
 }
 
 LedStripAdapterLPD8806::~LedStripAdapterLPD8806() {
-    // Explicitly delete dynamically allocated LED strip helper instance
-    delete &this->strip;
+    // Explicitly delete dynamically allocated LED strip helper instance, color table and dither bits
+    delete this->strip;
+    free(this->colorTable);
+    free(this->ditherBits);
+}
+
+float LedStripAdapterLPD8806::getGamma() {
+    return this->gamma;
+}
+
+void LedStripAdapterLPD8806::setGamma(float gamma) {
+    this->gamma = gamma;
+    this->updateColorTable();
+}
+
+uint8_t LedStripAdapterLPD8806::getBrightness() {
+    return this->brightness;
+}
+
+void LedStripAdapterLPD8806::setBrightness(uint8_t brightness) {
+    this->brightness = brightness;
+    this->updateColorTable();
+}
+
+uint32_t LedStripAdapterLPD8806::getSpiClock() {
+    return this->strip->getClock();
+}
+
+void LedStripAdapterLPD8806::setSpiClock(uint32_t spiClock) {
+    this->strip->setClock(spiClock);
+}
+
+uint32_t LedStripAdapterLPD8806::testSpiClock(uint32_t minSpiClock, uint32_t maxSpiClock) {
+    return this->strip->testClock(minSpiClock, maxSpiClock);
+}
+
+bool LedStripAdapterLPD8806::isDoubleBuffered() {
+    return this->strip->isDoubleBuffered();
+}
+
+bool LedStripAdapterLPD8806::setDoubleBuffered(bool doubleBuffered) {
+    return this->setDoubleBuffered(doubleBuffered, true);
+}
+
+bool LedStripAdapterLPD8806::setDoubleBuffered(bool doubleBuffered, bool keepContents) {
+    this->presentKeepsContents = keepContents;
+    return this->strip->setDoubleBuffer(doubleBuffered);
+}
+
+bool LedStripAdapterLPD8806::isDithering() {
+    return this->ditherBits != NULL;
+}
+
+bool LedStripAdapterLPD8806::setDithering(bool dithering) {
+    // Nothing to do if the state doesn't change
+    if(dithering == (this->ditherBits != NULL))
+        return true;
+
+    // Detach the bits from the strip before freeing them, or allocate them cleared, as the low bits aren't known yet
+    if(!dithering) {
+        this->strip->setDither(NULL);
+        free(this->ditherBits);
+        this->ditherBits = NULL;
+    } else if((this->ditherBits = (uint8_t*) calloc(LPD8806_DITHER_BITS_SIZE(this->strip->numPixels()), 1)) == NULL)
+        return false;
+    else
+        this->strip->setDither(this->ditherBits);
+
+    // The output of the next frame differs, make sure it is rendered
+    this->invalidate();
+    return true;
+}
+
+uint8_t LedStripAdapterLPD8806::getDitherBits(uint16_t ledIndex) {
+    return (uint8_t) (this->ditherBits[ledIndex >> 1] >> ((ledIndex & 1) << 2)) & 0x07;
+}
+
+void LedStripAdapterLPD8806::setDitherBits(uint16_t ledIndex, uint8_t bits) {
+    uint8_t shift = (uint8_t) ((ledIndex & 1) << 2);
+    uint8_t* nibbles = this->ditherBits + (ledIndex >> 1);
+    *nibbles = (uint8_t) ((*nibbles & ~(0x0F << shift)) | (bits << shift));
+}
+
+LedStripPowerBudget* LedStripAdapterLPD8806::getPowerBudget() {
+    return this->powerBudget;
+}
+
+void LedStripAdapterLPD8806::setPowerBudget(LedStripPowerBudget* powerBudget) {
+    // Count the channel sums of the current frame once, the writes keep them up to date from here
+    this->powerBudget = powerBudget;
+    this->updatePowerBudget();
+
+    // The scale of the next frame may differ, make sure it is rendered
+    this->invalidate();
+}
+
+void LedStripAdapterLPD8806::updatePowerBudget() {
+    this->powerBudgetStale = false;
+    if(this->powerBudget == NULL)
+        return;
+
+    // Sum the 7-bit channel values of all LEDs
+    uint16_t ledCount = this->strip->numPixels();
+    uint8_t* pixel = this->strip->getPixels();
+    this->powerBudget->reset(ledCount, LPD8806_COLOR_VALUE_MAX);
+    for(uint16_t i = 0; i < ledCount; i++, pixel += LedStripPixelLPD8806::BYTES_PER_PIXEL)
+        this->powerBudget->add(pixel[LedStripPixelLPD8806::RED_INDEX] & LPD8806_COLOR_VALUE_MAX,
+                               pixel[LedStripPixelLPD8806::GREEN_INDEX] & LPD8806_COLOR_VALUE_MAX,
+                               pixel[LedStripPixelLPD8806::BLUE_INDEX] & LPD8806_COLOR_VALUE_MAX);
+}
+
+void LedStripAdapterLPD8806::applyPowerBudget() {
+    // Recount the sums if the pixels were written directly
+    if(this->powerBudgetStale)
+        this->updatePowerBudget();
+
+    this->strip->setScale(this->powerBudget != NULL ? this->powerBudget->getScale() : (uint8_t) 255);
+}
+
+void LedStripAdapterLPD8806::setChannelScale(uint8_t redScale, uint8_t greenScale, uint8_t blueScale) {
+    this->channelScale[0] = redScale;
+    this->channelScale[1] = greenScale;
+    this->channelScale[2] = blueScale;
+    this->updateColorTable();
+}
+
+void LedStripAdapterLPD8806::updateColorTable() {
+    // Determine whether any correction is configured
+    bool correct = this->gamma != 1.0f || this->brightness != LED_STRIP_COLOR_VALUE_MAX;
+    for(uint8_t channel = 0; channel < LPD8806_COLOR_CHANNEL_COUNT; channel++)
+        correct |= this->channelScale[channel] != LED_STRIP_COLOR_VALUE_MAX;
+
+    // Without correction, the table is just the 7-bit reduction, which is cheaper to compute directly
+    if(!correct) {
+        free(this->colorTable);
+        this->colorTable = NULL;
+        return;
+    }
+
+    // Allocate the table
+    if(this->colorTable == NULL && (this->colorTable = (uint8_t*) malloc(LPD8806_COLOR_TABLE_SIZE)) == NULL)
+        return;
+
+    // Build the table, the floating point gamma curve is only evaluated here
+    for(uint16_t value = 0; value < LED_STRIP_COLOR_VALUE_SIZE; value++) {
+        // Apply the gamma curve and the global brightness
+        uint16_t corrected = this->gamma == 1.0f ? value :
+                (uint16_t) (pow(value / (float) LED_STRIP_COLOR_VALUE_MAX, this->gamma) * LED_STRIP_COLOR_VALUE_MAX + 0.5f);
+        corrected = (corrected * (this->brightness + 1)) >> 8;
+
+        // Apply the channel scale for each channel
+        for(uint8_t channel = 0; channel < LPD8806_COLOR_CHANNEL_COUNT; channel++)
+            this->colorTable[channel * LED_STRIP_COLOR_VALUE_SIZE + value] =
+                    (uint8_t) ((corrected * (this->channelScale[channel] + 1)) >> 8);
+    }
 }
 
 void LedStripAdapterLPD8806::init() {
@@ -47,8 +224,75 @@ void LedStripAdapterLPD8806::init(bool render) {
 }
 
 void LedStripAdapterLPD8806::render() {
-    // Render the LED strip
+    // Skip rendering if nothing has changed since the last frame
+    if(!this->isDirty())
+        return;
+
+    // Render the LED strip, scaled to the power budget
+    this->applyPowerBudget();
     this->strip->show();
+    this->markRendered();
+}
+
+void LedStripAdapterLPD8806::renderAsync() {
+    // Skip rendering if nothing has changed since the last frame
+    if(!this->isDirty())
+        return;
+
+    // Start rendering the LED strip in the background, scaled to the power budget
+    this->applyPowerBudget();
+    this->strip->showAsync();
+    this->markRendered();
+}
+
+bool LedStripAdapterLPD8806::isDirty() {
+    // The dithered output alternates, so there's a new frame to render even if no LED changed
+    // Reporting it here makes groups and frame statistics treat the strip as changed as well
+    return LedStripAdapterBase::isDirty() || this->ditherBits != NULL;
+}
+
+bool LedStripAdapterLPD8806::isRenderComplete() {
+    return this->strip->isShowComplete();
+}
+
+void LedStripAdapterLPD8806::present() {
+    // Skip presenting if nothing has changed since the last frame
+    if(!this->isDirty())
+        return;
+
+    // Swap the buffers, and render the drawn one in the background, scaled to the power budget
+    this->applyPowerBudget();
+    this->strip->present(this->presentKeepsContents);
+    this->markRendered();
+
+    // Without the copy, the drawing buffer holds an older frame than the presented one
+    // Its pixels can't be compared against to skip unchanged writes, and the power budget must be recounted from it
+    if(!this->presentKeepsContents && this->strip->isDoubleBuffered()) {
+        this->powerBudgetStale = this->powerBudget != NULL;
+        this->invalidate();
+    }
+}
+
+void LedStripAdapterLPD8806::renderParallel(LedStripAdapterLPD8806** adapters, uint8_t count) {
+    // Collect the changed strips, and show them in batches
+    LPD8806* strips[LPD8806_PARALLEL_MAX];
+    uint8_t stripCount = 0;
+    for(uint8_t i = 0; i < count; i++) {
+        LedStripAdapterLPD8806* adapter = adapters[i];
+        if(adapter == NULL || !adapter->isDirty())
+            continue;
+
+        adapter->applyPowerBudget();
+        strips[stripCount++] = adapter->strip;
+        adapter->markRendered();
+
+        if(stripCount == LPD8806_PARALLEL_MAX) {
+            LPD8806::showParallel(strips, stripCount);
+            stripCount = 0;
+        }
+    }
+    if(stripCount > 0)
+        LPD8806::showParallel(strips, stripCount);
 }
 
 uint16_t LedStripAdapterLPD8806::getLedCount() {
@@ -56,11 +300,35 @@ uint16_t LedStripAdapterLPD8806::getLedCount() {
 }
 
 void LedStripAdapterLPD8806::setLedCount(uint16_t ledCount) {
-    return this->strip->updateLength(ledCount);
+    // Update the length, and make sure the resized strip is rendered
+    this->strip->updateLength(ledCount);
+
+    // Reallocate the dither bits for the new length, the pixels were reallocated as well
+    // If that fails, dithering is off, which isDithering() reports
+    if(this->ditherBits != NULL) {
+        this->setDithering(false);
+        this->setDithering(true);
+    }
+    this->updatePowerBudget();
+    this->invalidate();
 }
 
 LedStripColor LedStripAdapterLPD8806::getLedColor(uint16_t ledIndex) {
-    return LedStripColor::fromCombinedChannels(this->getLedColorCombinedChannels(ledIndex));
+    // Make sure the LED is on the strip
+    if(ledIndex >= this->strip->numPixels())
+        return LedStripColor::black();
+
+    // Decode the native pixel straight from the buffer
+    uint8_t* pixel = this->strip->getPixels() + ledIndex * LedStripPixelLPD8806::BYTES_PER_PIXEL;
+    if(this->ditherBits == NULL)
+        return LedStripPixelLPD8806::decode(pixel);
+
+    // Restore the low bits kept for dithering, to give back the full 8-bit values
+    uint8_t bits = this->getDitherBits(ledIndex);
+    return LedStripColor(
+            (uint8_t) (pixel[LedStripPixelLPD8806::RED_INDEX] << 1) | ((bits >> LedStripPixelLPD8806::RED_INDEX) & 1),
+            (uint8_t) (pixel[LedStripPixelLPD8806::GREEN_INDEX] << 1) | ((bits >> LedStripPixelLPD8806::GREEN_INDEX) & 1),
+            (uint8_t) (pixel[LedStripPixelLPD8806::BLUE_INDEX] << 1) | ((bits >> LedStripPixelLPD8806::BLUE_INDEX) & 1));
 }
 
 void LedStripAdapterLPD8806::setLedColor(uint16_t ledIndex, LedStripColor color) {
@@ -69,31 +337,50 @@ void LedStripAdapterLPD8806::setLedColor(uint16_t ledIndex, LedStripColor color)
 }
 
 void LedStripAdapterLPD8806::setLedColor(uint16_t ledIndex, uint8_t redChannel) {
-    // Get the color of the LED
-    LedStripColor ledColor = this->getLedColor(ledIndex);
-
-    // Set the red channel
-    ledColor.setRed(redChannel);
-
-    // Update the led color
-    this->setLedColor(ledIndex, ledColor);
+    // Set the red channel, and keep the others
+    this->setLedChannels(ledIndex, redChannel, 0, 0, 1 << LedStripPixelLPD8806::RED_INDEX);
 }
 
 void LedStripAdapterLPD8806::setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel) {
-    // Get the color of the LED
-    LedStripColor ledColor = this->getLedColor(ledIndex);
+    // Set the red and green channel, and keep the blue channel
+    this->setLedChannels(ledIndex, redChannel, greenChannel, 0,
+                         1 << LedStripPixelLPD8806::RED_INDEX | 1 << LedStripPixelLPD8806::GREEN_INDEX);
+}
+
+void LedStripAdapterLPD8806::setLedChannels(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel,
+                                            uint8_t blueChannel, uint8_t channelMask) {
+    // Make sure the LED is on the strip
+    if(ledIndex >= this->strip->numPixels())
+        return;
 
-    // Set the red and green channel
-    ledColor.setRed(redChannel);
-    ledColor.setGreen(greenChannel);
+    // Translate the color to the hardware color
+    uint8_t* pixel = this->strip->getPixels() + ledIndex * 3;
+    uint8_t hardwareColor[3];
+    uint8_t lowBits = this->translateColor(redChannel, greenChannel, blueChannel, hardwareColor);
 
-    // Update the led color
-    this->setLedColor(ledIndex, ledColor);
+    // Keep the other channels as they are, their values are already corrected and can't be translated again
+    uint8_t keptLowBits = this->ditherBits != NULL ? this->getDitherBits(ledIndex) : (uint8_t) 0;
+    for(uint8_t i = 0; i < 3; i++) {
+        if(!(channelMask & (1 << i))) {
+            hardwareColor[i] = pixel[i];
+            lowBits = (uint8_t) ((lowBits & ~(1 << i)) | (keptLowBits & (1 << i)));
+        }
+    }
+
+    // Write the pixel, and mark it as dirty if it changed
+    if(this->writeHardwarePixel(ledIndex, pixel, hardwareColor, lowBits))
+        this->markDirty(ledIndex, ledIndex + 1, 1);
 }
 
 void LedStripAdapterLPD8806::setLedColor(uint16_t ledIndex,
                                          uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel) {
-    this->strip->setPixelColor(ledIndex, redChannel / 2, greenChannel / 2, blueChannel / 2);
+    // Make sure the LED is on the strip
+    if(ledIndex >= this->strip->numPixels())
+        return;
+
+    // Write the pixel, and mark it as dirty if it changed
+    if(this->writePixel(ledIndex, this->strip->getPixels() + ledIndex * 3, redChannel, greenChannel, blueChannel))
+        this->markDirty(ledIndex, ledIndex + 1, 1);
 }
 
 void LedStripAdapterLPD8806::setLedColor(uint16_t ledIndex,
@@ -104,23 +391,234 @@ void LedStripAdapterLPD8806::setLedColor(uint16_t ledIndex,
 }
 
 uint32_t LedStripAdapterLPD8806::getLedColorCombinedChannels(uint16_t ledIndex) {
-    // Get the raw color value
-    uint32_t rawColor = this->strip->getPixelColor(ledIndex);
+    return this->getLedColor(ledIndex).getCombinedChannels();
+}
+
+uint32_t LedStripAdapterLPD8806::getTransferRate() {
+    return this->strip->getTransferRate();
+}
+
+uint8_t* LedStripAdapterLPD8806::getNativePixels() {
+    return this->strip->getPixels();
+}
+
+bool LedStripAdapterLPD8806::getPixelFormat(LedStripPixelFormat* format) {
+    *format = LedStripPixelLPD8806::getFormat();
+    return true;
+}
+
+void LedStripAdapterLPD8806::markNativePixelsChanged(uint16_t fromLedIndex, uint16_t toLedIndex) {
+    // The previous values of the written pixels are gone, recount the power budget before the next render
+    this->powerBudgetStale = this->powerBudget != NULL;
 
-    // Translate the color to the LED strip color space, and return
-    return ((uint32_t) (rawColor & (uint32_t) 0xFF << 8)<<  24) |
-           ((uint32_t) (rawColor & (uint32_t) 0xFF << 16) << 16) |
-           ((uint32_t) (rawColor & (uint32_t) 0xFF << 0) << 8) |
-           LED_STRIP_COLOR_VALUE_MAX & 0xFF;
+    // Native values are 7-bit, there are no low bits to dither with
+    if(this->ditherBits != NULL) {
+        uint16_t ledCount = this->strip->numPixels();
+        for(uint16_t i = fromLedIndex; i < toLedIndex && i < ledCount; i++)
+            this->setDitherBits(i, 0);
+    }
+    LedStripAdapterBase::markNativePixelsChanged(fromLedIndex, toLedIndex);
 }
 
 void LedStripAdapterLPD8806::setLedColorCombinedChannels(uint16_t ledIndex, uint32_t combinedColorValue) {
-    // Translate and set the LED strip color to the hardware color
-    this->strip->setPixelColor(ledIndex,
-            ((uint32_t) ((combinedColorValue & (uint32_t) 0xFF << 24) / 2 >> 24) | 0x80) << 8 |
-            ((uint32_t) ((combinedColorValue & (uint32_t) 0xFF << 16) / 2 >> 16) | 0x80) << 16 |
-            ((uint32_t) ((combinedColorValue & (uint32_t) 0xFF << 8) / 2 >> 8) | 0x80) << 0
-    );
+    // Split the combined value into its channels, and set the LEDs color
+    this->setLedColor(ledIndex,
+                      (uint8_t) (combinedColorValue >> 24),
+                      (uint8_t) (combinedColorValue >> 16),
+                      (uint8_t) (combinedColorValue >> 8));
+}
+
+void LedStripAdapterLPD8806::setLedColors(uint16_t fromLedIndex, LedStripColor* colors, uint16_t count) {
+    // Clip the span to the strip once, instead of bounds checking each LED
+    count = this->clipLedCount(fromLedIndex, count);
+
+    // Write the colors straight into the hardware buffer, and keep track of the changed range
+    uint8_t* pixel = this->strip->getPixels() + fromLedIndex * 3;
+    uint16_t changedFrom = count, changedTo = 0, changedCount = 0;
+    for(uint16_t i = 0; i < count; i++, pixel += 3) {
+        if(this->writePixel(fromLedIndex + i, pixel, colors[i].getRed(), colors[i].getGreen(), colors[i].getBlue())) {
+            if(changedCount++ == 0)
+                changedFrom = i;
+            changedTo = i + 1;
+        }
+    }
+
+    // Mark the changed range as dirty
+    this->markDirty(fromLedIndex + changedFrom, fromLedIndex + changedTo, changedCount);
+}
+
+void LedStripAdapterLPD8806::setLedColorsCombinedChannels(uint16_t fromLedIndex, uint32_t* combinedColorValues,
+                                                          uint16_t count) {
+    // Clip the span to the strip once, instead of bounds checking each LED
+    count = this->clipLedCount(fromLedIndex, count);
+
+    // Write the colors straight into the hardware buffer, and keep track of the changed range
+    uint8_t* pixel = this->strip->getPixels() + fromLedIndex * 3;
+    uint16_t changedFrom = count, changedTo = 0, changedCount = 0;
+    for(uint16_t i = 0; i < count; i++, pixel += 3) {
+        uint32_t combinedColorValue = combinedColorValues[i];
+        if(this->writePixel(fromLedIndex + i, pixel,
+                            (uint8_t) (combinedColorValue >> 24),
+                            (uint8_t) (combinedColorValue >> 16),
+                            (uint8_t) (combinedColorValue >> 8))) {
+            if(changedCount++ == 0)
+                changedFrom = i;
+            changedTo = i + 1;
+        }
+    }
+
+    // Mark the changed range as dirty
+    this->markDirty(fromLedIndex + changedFrom, fromLedIndex + changedTo, changedCount);
+}
+
+void LedStripAdapterLPD8806::setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, LedStripColor color) {
+    this->fillLedColors(fromLedIndex, toLedIndex, color.getRed(), color.getGreen(), color.getBlue());
+}
+
+void LedStripAdapterLPD8806::setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, uint8_t redChannel) {
+    // Partial channel updates keep the other channels of each LED, use the per-LED implementation
+    LedStripAdapterBase::setRangeLedColors(fromLedIndex, toLedIndex, redChannel);
+}
+
+void LedStripAdapterLPD8806::setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, uint8_t redChannel,
+                                               uint8_t greenChannel) {
+    // Partial channel updates keep the other channels of each LED, use the per-LED implementation
+    LedStripAdapterBase::setRangeLedColors(fromLedIndex, toLedIndex, redChannel, greenChannel);
+}
+
+void LedStripAdapterLPD8806::setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, uint8_t redChannel,
+                                               uint8_t greenChannel, uint8_t blueChannel) {
+    this->fillLedColors(fromLedIndex, toLedIndex, redChannel, greenChannel, blueChannel);
+}
+
+void LedStripAdapterLPD8806::setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, uint8_t redChannel,
+                                               uint8_t greenChannel, uint8_t blueChannel, uint8_t) {
+    // Set the colors without the alpha channel, since this channel isn't supported
+    this->fillLedColors(fromLedIndex, toLedIndex, redChannel, greenChannel, blueChannel);
+}
+
+void LedStripAdapterLPD8806::setRangeLedColorsCombinedChannels(uint16_t fromLedIndex, uint16_t toLedIndex,
+                                                               uint32_t combinedColorValue) {
+    this->fillLedColors(fromLedIndex, toLedIndex,
+                        (uint8_t) (combinedColorValue >> 24),
+                        (uint8_t) (combinedColorValue >> 16),
+                        (uint8_t) (combinedColorValue >> 8));
+}
+
+uint8_t LedStripAdapterLPD8806::translateColor(uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel,
+                                               uint8_t* hardwareColor) {
+    // Look up the corrected values if a table is configured
+    if(this->colorTable != NULL) {
+        redChannel = this->colorTable[redChannel];
+        greenChannel = this->colorTable[LED_STRIP_COLOR_VALUE_SIZE + greenChannel];
+        blueChannel = this->colorTable[LED_STRIP_COLOR_VALUE_SIZE * 2 + blueChannel];
+    }
+
+    // Encode the values, and return the low bits lost in the reduction
+    LedStripPixelLPD8806::encode(hardwareColor, redChannel, greenChannel, blueChannel);
+    return (uint8_t) (((greenChannel & 1) << LedStripPixelLPD8806::GREEN_INDEX) |
+                      ((redChannel & 1) << LedStripPixelLPD8806::RED_INDEX) |
+                      ((blueChannel & 1) << LedStripPixelLPD8806::BLUE_INDEX));
+}
+
+bool LedStripAdapterLPD8806::writePixel(uint16_t ledIndex, uint8_t* pixel, uint8_t redChannel, uint8_t greenChannel,
+                                        uint8_t blueChannel) {
+    // Translate the color to the hardware color, and write it
+    uint8_t hardwareColor[3];
+    uint8_t lowBits = this->translateColor(redChannel, greenChannel, blueChannel, hardwareColor);
+    return this->writeHardwarePixel(ledIndex, pixel, hardwareColor, lowBits);
+}
+
+bool LedStripAdapterLPD8806::writeHardwarePixel(uint16_t ledIndex, uint8_t* pixel, uint8_t* hardwareColor,
+                                                uint8_t lowBits) {
+    // Keep the low bits for dithering
+    bool changed = false;
+    if(this->ditherBits != NULL && this->getDitherBits(ledIndex) != lowBits) {
+        this->setDitherBits(ledIndex, lowBits);
+        changed = true;
+    }
+
+    // Don't touch the pixel if it doesn't change
+    if(pixel[0] == hardwareColor[0] && pixel[1] == hardwareColor[1] && pixel[2] == hardwareColor[2])
+        return changed;
+
+    // Move the pixel in the channel sums of the power budget
+    if(this->powerBudget != NULL) {
+        this->powerBudget->remove(pixel[LedStripPixelLPD8806::RED_INDEX] & LPD8806_COLOR_VALUE_MAX,
+                                  pixel[LedStripPixelLPD8806::GREEN_INDEX] & LPD8806_COLOR_VALUE_MAX,
+                                  pixel[LedStripPixelLPD8806::BLUE_INDEX] & LPD8806_COLOR_VALUE_MAX);
+        this->powerBudget->add(hardwareColor[LedStripPixelLPD8806::RED_INDEX] & LPD8806_COLOR_VALUE_MAX,
+                               hardwareColor[LedStripPixelLPD8806::GREEN_INDEX] & LPD8806_COLOR_VALUE_MAX,
+                               hardwareColor[LedStripPixelLPD8806::BLUE_INDEX] & LPD8806_COLOR_VALUE_MAX);
+    }
+
+    // Write the pixel
+    pixel[0] = hardwareColor[0];
+    pixel[1] = hardwareColor[1];
+    pixel[2] = hardwareColor[2];
+    return true;
+}
+
+uint16_t LedStripAdapterLPD8806::clipLedCount(uint16_t fromLedIndex, uint16_t count) {
+    // Get the number of LEDs on the strip
+    uint16_t ledCount = this->strip->numPixels();
+
+    // Nothing is left if the span starts beyond the strip
+    if(fromLedIndex >= ledCount)
+        return 0;
+
+    // Cut off the part of the span that falls beyond the strip
+    if(count > ledCount - fromLedIndex)
+        return ledCount - fromLedIndex;
+    return count;
+}
+
+void LedStripAdapterLPD8806::fillLedColors(uint16_t fromLedIndex, uint16_t toLedIndex,
+                                           uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel) {
+    // Make sure the range isn't empty
+    if(toLedIndex <= fromLedIndex)
+        return;
+
+    // Clip the range to the strip once, instead of bounds checking each LED
+    uint16_t count = this->clipLedCount(fromLedIndex, toLedIndex - fromLedIndex);
+
+    // Translate the color to the hardware color once
+    uint8_t hardwareColor[3];
+    uint8_t lowBits = this->translateColor(redChannel, greenChannel, blueChannel, hardwareColor);
+    uint8_t green = hardwareColor[0];
+    uint8_t red = hardwareColor[1];
+    uint8_t blue = hardwareColor[2];
+
+    // Fill the hardware buffer, and keep track of the changed range
+    uint8_t* pixel = this->strip->getPixels() + fromLedIndex * 3;
+    uint16_t changedFrom = count, changedTo = 0, changedCount = 0;
+    for(uint16_t i = 0; i < count; i++, pixel += 3) {
+        bool changed = false;
+        if(this->ditherBits != NULL && this->getDitherBits(fromLedIndex + i) != lowBits) {
+            this->setDitherBits(fromLedIndex + i, lowBits);
+            changed = true;
+        }
+        if(pixel[0] != green || pixel[1] != red || pixel[2] != blue) {
+            if(this->powerBudget != NULL) {
+                this->powerBudget->remove(pixel[1] & LPD8806_COLOR_VALUE_MAX, pixel[0] & LPD8806_COLOR_VALUE_MAX,
+                                          pixel[2] & LPD8806_COLOR_VALUE_MAX);
+                this->powerBudget->add(red & LPD8806_COLOR_VALUE_MAX, green & LPD8806_COLOR_VALUE_MAX,
+                                       blue & LPD8806_COLOR_VALUE_MAX);
+            }
+            pixel[0] = green;
+            pixel[1] = red;
+            pixel[2] = blue;
+            changed = true;
+        }
+        if(changed) {
+            if(changedCount++ == 0)
+                changedFrom = i;
+            changedTo = i + 1;
+        }
+    }
+
+    // Mark the changed range as dirty
+    this->markDirty(fromLedIndex + changedFrom, fromLedIndex + changedTo, changedCount);
 }
 
 uint8_t LedStripAdapterLPD8806::getColorChannelCount() {
@@ -26,9 +26,13 @@
 #include "LedStripLPD8806Helper.h"
 #include "LedStripColor.h"
 #include "LedStripAdapterBase.h"
+#include "LedStripPixelLPD8806.h"
+#include "LedStripPowerBudget.h"
 
 #define LPD8806_COLOR_CHANNEL_COUNT 3
 #define LPD8806_COLOR_VALUE_MAX 127
+#define LPD8806_COLOR_TABLE_SIZE (LED_STRIP_COLOR_VALUE_SIZE * LPD8806_COLOR_CHANNEL_COUNT)
+#define LPD8806_DITHER_BITS_SIZE(ledCount) (((ledCount) + 1) / 2)
 
 /**
  * LED strip adapter for LPD8806 type LED strips.
@@ -43,6 +47,164 @@ private:
      */
     LPD8806* strip;
 
+    /**
+     * Gamma correction exponent.
+     */
+    float gamma;
+
+    /**
+     * Global brightness.
+     */
+    uint8_t brightness;
+
+    /**
+     * Per-channel scale, in red, green, blue order.
+     */
+    uint8_t channelScale[LPD8806_COLOR_CHANNEL_COUNT];
+
+    /**
+     * Color lookup table, translating each 8-bit channel value to its hardware value.
+     * The red, green and blue tables follow each other, and include the gamma correction, brightness and channel scale.
+     * The corrected values are kept at 8 bits, so the bit lost in the 7-bit reduction is known for dithering.
+     * NULL if no correction is configured, in which case the value is just halved.
+     */
+    uint8_t* colorTable;
+
+    /**
+     * The low bit lost in the 7-bit reduction of each channel, a nibble per LED in the order of the hardware buffer, see
+     * LPD8806::setDither(). NULL if dithering is disabled.
+     */
+    uint8_t* ditherBits;
+
+    /**
+     * True if present() starts the new drawing buffer off as a copy of the presented frame.
+     */
+    bool presentKeepsContents;
+
+    /**
+     * Power budget the frame is limited to, or NULL if the frame isn't limited.
+     */
+    LedStripPowerBudget* powerBudget;
+
+    /**
+     * True if the native pixels were written directly, so the channel sums of the power budget must be recounted.
+     */
+    bool powerBudgetStale;
+
+    /**
+     * Recount the channel sums of the power budget from the pixel buffer.
+     */
+    void updatePowerBudget();
+
+    /**
+     * Set the output scale of the strip for the frame about to be rendered, following the power budget.
+     */
+    void applyPowerBudget();
+
+    /**
+     * Rebuild the color lookup table after the color correction settings have changed.
+     */
+    void updateColorTable();
+
+    /**
+     * Take ownership of the given LPD8806 strip instance, and reset the color correction.
+     * Shared by the constructors.
+     *
+     * @param strip LPD8806 strip instance.
+     */
+    void attachStrip(LPD8806* strip);
+
+    /**
+     * Translate a color to the hardware color.
+     *
+     * @param redChannel Color value of the red channel.
+     * @param greenChannel Color value of the green channel.
+     * @param blueChannel Color value of the blue channel.
+     * @param hardwareColor Buffer of three bytes, to write the hardware color to in GRB order.
+     *
+     * @return The low bits lost in the 7-bit reduction, bit 0 to 2 for hardware bytes 0 to 2.
+     */
+    uint8_t translateColor(uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel, uint8_t* hardwareColor);
+
+    /**
+     * Get the dither bits of an LED.
+     *
+     * @param ledIndex LED index.
+     *
+     * @return The low bits lost in the 7-bit reduction, bit 0 to 2 for hardware bytes 0 to 2.
+     */
+    uint8_t getDitherBits(uint16_t ledIndex);
+
+    /**
+     * Set the dither bits of an LED.
+     *
+     * @param ledIndex LED index.
+     * @param bits The low bits lost in the 7-bit reduction, bit 0 to 2 for hardware bytes 0 to 2.
+     */
+    void setDitherBits(uint16_t ledIndex, uint8_t bits);
+
+    /**
+     * Write a color into a pixel of the hardware buffer.
+     *
+     * @param ledIndex LED index of the pixel.
+     * @param pixel Pointer to the pixel in the hardware buffer.
+     * @param redChannel Color value of the red channel.
+     * @param greenChannel Color value of the green channel.
+     * @param blueChannel Color value of the blue channel.
+     *
+     * @return True if the pixel changed, false if it already had this color.
+     */
+    bool writePixel(uint16_t ledIndex, uint8_t* pixel, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel);
+
+    /**
+     * Write a hardware color into a pixel of the hardware buffer.
+     *
+     * @param ledIndex LED index of the pixel.
+     * @param pixel Pointer to the pixel in the hardware buffer.
+     * @param hardwareColor Hardware color, in GRB order.
+     * @param lowBits The low bits lost in the 7-bit reduction, bit 0 to 2 for hardware bytes 0 to 2.
+     *
+     * @return True if the pixel changed, false if it already had this color.
+     */
+    bool writeHardwarePixel(uint16_t ledIndex, uint8_t* pixel, uint8_t* hardwareColor, uint8_t lowBits);
+
+    /**
+     * Set some of the channels of an LED, and keep the others.
+     * Only the given channels go through the color correction. The kept channels are left at their hardware values,
+     * since getLedColor() returns corrected values that would be corrected once more when written back.
+     *
+     * @param ledIndex LED index.
+     * @param redChannel Color value of the red channel.
+     * @param greenChannel Color value of the green channel.
+     * @param blueChannel Color value of the blue channel.
+     * @param channelMask Channels to set, bit 0 to 2 for hardware bytes 0 to 2.
+     */
+    void setLedChannels(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel,
+                        uint8_t channelMask);
+
+    /**
+     * Clip a span of LEDs to the bounds of the strip.
+     *
+     * @param fromLedIndex Index of the first LED in the span.
+     * @param count Number of LEDs in the span.
+     *
+     * @return Number of LEDs in the span that are on the strip.
+     */
+    uint16_t clipLedCount(uint16_t fromLedIndex, uint16_t count);
+
+    /**
+     * Fill the given range of the hardware buffer with a single color.
+     * The range is clipped to the strip bounds once, after which the pixels are written directly.
+     *
+     * @param fromLedIndex From LED index.
+     * @param toLedIndex To LED index. (excluded)
+     * @param redChannel Color value of the red channel.
+     * @param greenChannel Color value of the green channel.
+     * @param blueChannel Color value of the blue channel.
+     */
+    void fillLedColors(uint16_t fromLedIndex, uint16_t toLedIndex,
+                       uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel);
+
 public:
     /**
      * Constructor.
@@ -53,11 +215,158 @@ public:
      */
     LedStripAdapterLPD8806(uint16_t ledCount, uint8_t pinData, uint8_t pinClock);
 
+    /**
+     * Constructor, for strips on the hardware SPI pins.
+     * The SPI bus is claimed with these settings for each rendered frame only, so it may be shared with other devices.
+     *
+     * @param ledCount Number of LEDs.
+     * @param spiClock SPI clock in Hz.
+     */
+    LedStripAdapterLPD8806(uint16_t ledCount, uint32_t spiClock);
+
     /**
      * Destructor.
      */
     ~LedStripAdapterLPD8806();
 
+    /**
+     * Get the gamma correction exponent.
+     *
+     * @return Gamma, 1.0 if no gamma correction is applied.
+     */
+    float getGamma();
+
+    /**
+     * Set the gamma correction exponent.
+     * This is applied to LED colors written after this call, through the color lookup table.
+     *
+     * @param gamma Gamma, such as 2.2, or 1.0 to disable gamma correction.
+     */
+    void setGamma(float gamma);
+
+    /**
+     * Get the global brightness.
+     *
+     * @return Brightness, 255 for full brightness.
+     */
+    uint8_t getBrightness();
+
+    /**
+     * Set the global brightness.
+     * This is applied to LED colors written after this call, through the color lookup table.
+     *
+     * @param brightness Brightness, 255 for full brightness.
+     */
+    void setBrightness(uint8_t brightness);
+
+    /**
+     * Set the scale of each color channel, for example to white balance the LED strip.
+     * This is applied to LED colors written after this call, through the color lookup table.
+     *
+     * @param redScale Scale of the red channel, 255 for no scaling.
+     * @param greenScale Scale of the green channel, 255 for no scaling.
+     * @param blueScale Scale of the blue channel, 255 for no scaling.
+     */
+    void setChannelScale(uint8_t redScale, uint8_t greenScale, uint8_t blueScale);
+
+    /**
+     * Get the hardware SPI clock.
+     *
+     * @return SPI clock in Hz.
+     */
+    uint32_t getSpiClock();
+
+    /**
+     * Set the hardware SPI clock.
+     * This is applied from the next render, and has no effect on strips driven through arbitrary pins.
+     *
+     * @param spiClock SPI clock in Hz.
+     */
+    void setSpiClock(uint32_t spiClock);
+
+    /**
+     * Find the highest usable hardware SPI clock.
+     * The clock is doubled from the minimum up to the maximum, while a test pattern is read back intact on MISO.
+     * MISO must be looped back to MOSI. The strip keeps its colors, and the configured clock is left unchanged.
+     * The adapter must be initialized first.
+     *
+     * @param minSpiClock Clock to start the ramp at, in Hz.
+     * @param maxSpiClock Highest clock to test, in Hz.
+     *
+     * @return Highest clock in Hz at which the pattern was intact, or 0 if it never was.
+     */
+    uint32_t testSpiClock(uint32_t minSpiClock, uint32_t maxSpiClock);
+
+    /**
+     * Check whether double buffering is enabled.
+     *
+     * @return True if enabled, false if not.
+     */
+    bool isDoubleBuffered();
+
+    /**
+     * Enable or disable double buffering.
+     * With double buffering, present() renders the drawn frame from one buffer while drawing continues in the other.
+     * This requires a second buffer of the same size as the first.
+     *
+     * @param doubleBuffered True to enable, false to disable.
+     *
+     * @return False if the second buffer couldn't be allocated, true otherwise.
+     */
+    bool setDoubleBuffered(bool doubleBuffered);
+
+    /**
+     * Enable or disable double buffering, see setDoubleBuffered(bool).
+     * By default present() copies the presented frame into the new drawing buffer, so drawing may continue from it.
+     * Sketches that redraw every LED of every frame may skip this copy of the whole buffer. The drawing buffer then
+     * holds the frame before the presented one, and each present() renders, even if nothing has changed.
+     *
+     * @param doubleBuffered True to enable, false to disable.
+     * @param keepContents True to copy the presented frame into the new drawing buffer, false to skip the copy.
+     *
+     * @return False if the second buffer couldn't be allocated, true otherwise.
+     */
+    bool setDoubleBuffered(bool doubleBuffered, bool keepContents);
+
+    /**
+     * Get the power budget the frame is limited to.
+     *
+     * @return Power budget, or NULL if the frame isn't limited.
+     */
+    LedStripPowerBudget* getPowerBudget();
+
+    /**
+     * Limit the current draw of each rendered frame to the given power budget.
+     * The channel sums of the budget are counted once here, and kept up to date as LED colors are written. When a frame
+     * is over budget, it is scaled down as a whole while rendering, the LED colors themselves are left as they are.
+     * The budget tracks a single strip, and isn't owned by the adapter.
+     *
+     * @param powerBudget Power budget, or NULL to stop limiting.
+     */
+    void setPowerBudget(LedStripPowerBudget* powerBudget);
+
+    /**
+     * Check whether temporal dithering is enabled.
+     *
+     * @return True if enabled, false if not.
+     */
+    bool isDithering();
+
+    /**
+     * Enable or disable temporal dithering.
+     * The strip only takes 7-bit channel values, so each 8-bit value is halved. With dithering, the low bit lost in this
+     * reduction is kept for each channel, and rounds the channel up on every other rendered frame. Rendered at a high
+     * frame rate, the strip then shows the full 8-bit precision, which keeps dark fades smooth. Since the output keeps
+     * alternating, isDirty() returns true and every render outputs a frame, even if nothing has changed.
+     * This requires half a byte per LED, allocated here, the frame is dithered as it is sent. Only LED colors written
+     * after enabling are dithered.
+     *
+     * @param dithering True to enable, false to disable.
+     *
+     * @return False if the dither bits couldn't be allocated, true otherwise.
+     */
+    bool setDithering(bool dithering);
+
     // Override virtual method in BaseLedStripAdapter class
     void init();
 
@@ -67,13 +376,42 @@ public:
     // Override virtual method in BaseLedStripAdapter class
     void render();
 
+    // Override virtual method in BaseLedStripAdapter class
+    void renderAsync();
+
+    // Override virtual method in BaseLedStripAdapter class
+    bool isDirty();
+
+    // Override virtual method in BaseLedStripAdapter class
+    bool isRenderComplete();
+
+    // Override virtual method in BaseLedStripAdapter class
+    void present();
+
+    /**
+     * Render several LPD8806 LED strips together.
+     * Strips driven through pins on the same port are bit-banged in parallel, see LPD8806::showParallel().
+     * Strips that haven't changed since their last render are skipped.
+     *
+     * @param adapters LED strip adapters, NULL entries are skipped.
+     * @param count Number of entries.
+     */
+    static void renderParallel(LedStripAdapterLPD8806** adapters, uint8_t count);
+
     // Override virtual method in BaseLedStripAdapter class
     uint16_t getLedCount();
 
     // Override virtual method in BaseLedStripAdapter class
     void setLedCount(uint16_t ledCount);
 
-    // Override virtual method in BaseLedStripAdapter class
+    /**
+     * Get the color of an LED, as it is sent to the strip.
+     * With color correction configured, this is the corrected color rather than the color that was written.
+     *
+     * @param ledIndex LED index.
+     *
+     * @return LED color.
+     */
     LedStripColor getLedColor(uint16_t ledIndex);
 
     // Override virtual method in BaseLedStripAdapter class
@@ -94,9 +432,47 @@ public:
     // Override virtual method in BaseLedStripAdapter class
     uint32_t getLedColorCombinedChannels(uint16_t ledIndex);
 
+    // Override virtual method in BaseLedStripAdapter class
+    uint32_t getTransferRate();
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint8_t* getNativePixels();
+
+    // Override virtual method in BaseLedStripAdapter class
+    bool getPixelFormat(LedStripPixelFormat* format);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void markNativePixelsChanged(uint16_t fromLedIndex, uint16_t toLedIndex);
+
     // Override virtual method in BaseLedStripAdapter class
     void setLedColorCombinedChannels(uint16_t ledIndex, uint32_t combinedColorValue);
 
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColors(uint16_t fromLedIndex, LedStripColor* colors, uint16_t count);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColorsCombinedChannels(uint16_t fromLedIndex, uint32_t* combinedColorValues, uint16_t count);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, LedStripColor color);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, uint8_t redChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, uint8_t redChannel, uint8_t greenChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, uint8_t redChannel, uint8_t greenChannel,
+                           uint8_t blueChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, uint8_t redChannel, uint8_t greenChannel,
+                           uint8_t blueChannel, uint8_t alphaChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setRangeLedColorsCombinedChannels(uint16_t fromLedIndex, uint16_t toLedIndex, uint32_t combinedColorValue);
+
     // Override virtual method in BaseLedStripAdapter class
     uint8_t getColorChannelCount();
 
@@ -0,0 +1,169 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripAdapterLayer.h"
+
+LedStripAdapterLayer::LedStripAdapterLayer(uint16_t ledCount, uint8_t blendMode) {
+    // Set the fields
+    this->ledCount = ledCount;
+    this->blendMode = blendMode;
+    this->opacity = LAYER_COLOR_VALUE_MAX;
+    this->leds = NULL;
+
+    // Allocate the buffer
+    this->allocate();
+}
+
+LedStripAdapterLayer::~LedStripAdapterLayer() {
+    // Explicitly delete the dynamically allocated buffer
+    delete[] this->leds;
+}
+
+void LedStripAdapterLayer::allocate() {
+    // Delete the previous buffer
+    delete[] this->leds;
+
+    // Allocate the new buffer, and make every LED transparent so the layers below show through
+    this->leds = new LedStripColor[this->ledCount];
+    for(uint16_t i = 0; i < this->ledCount; i++)
+        this->leds[i].setAlpha(0);
+}
+
+LedStripColor* LedStripAdapterLayer::getLayerColors() {
+    return this->leds;
+}
+
+uint8_t LedStripAdapterLayer::getBlendMode() {
+    return this->blendMode;
+}
+
+void LedStripAdapterLayer::setBlendMode(uint8_t blendMode) {
+    // Every LED of the layer has to be blended again
+    this->blendMode = blendMode;
+    this->invalidate();
+}
+
+uint8_t LedStripAdapterLayer::getOpacity() {
+    return this->opacity;
+}
+
+void LedStripAdapterLayer::setOpacity(uint8_t opacity) {
+    // Every LED of the layer has to be blended again
+    if(this->opacity != opacity) {
+        this->opacity = opacity;
+        this->invalidate();
+    }
+}
+
+void LedStripAdapterLayer::markComposited() {
+    this->markRendered();
+}
+
+void LedStripAdapterLayer::init() { }
+
+void LedStripAdapterLayer::init(bool) { }
+
+void LedStripAdapterLayer::render() {
+    // Layers are rendered by their compositor, which keeps track of the changed range of each layer
+}
+
+uint16_t LedStripAdapterLayer::getLedCount() {
+    return this->ledCount;
+}
+
+void LedStripAdapterLayer::setLedCount(uint16_t ledCount) {
+    // Reallocate the buffer, and make sure the resized layer is blended
+    this->ledCount = ledCount;
+    this->allocate();
+    this->invalidate();
+}
+
+LedStripColor LedStripAdapterLayer::getLedColor(uint16_t ledIndex) {
+    // Make sure the LED is on the strip
+    if(ledIndex >= this->ledCount)
+        return LedStripColor(0, 0, 0, 0);
+
+    return this->leds[ledIndex];
+}
+
+void LedStripAdapterLayer::setLedColor(uint16_t ledIndex, LedStripColor color) {
+    this->setLedColor(ledIndex, color.getRed(), color.getGreen(), color.getBlue(), color.getAlpha());
+}
+
+void LedStripAdapterLayer::setLedColor(uint16_t ledIndex, uint8_t redChannel) {
+    // Get the color of the LED
+    LedStripColor ledColor = this->getLedColor(ledIndex);
+
+    // Set the red channel
+    ledColor.setRed(redChannel);
+
+    // Update the led color
+    this->setLedColor(ledIndex, ledColor);
+}
+
+void LedStripAdapterLayer::setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel) {
+    // Get the color of the LED
+    LedStripColor ledColor = this->getLedColor(ledIndex);
+
+    // Set the red and green channel
+    ledColor.setRed(redChannel);
+    ledColor.setGreen(greenChannel);
+
+    // Update the led color
+    this->setLedColor(ledIndex, ledColor);
+}
+
+void LedStripAdapterLayer::setLedColor(uint16_t ledIndex,
+                                       uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel) {
+    this->setLedColor(ledIndex, redChannel, greenChannel, blueChannel, (uint8_t) LED_STRIP_COLOR_VALUE_MAX);
+}
+
+void LedStripAdapterLayer::setLedColor(uint16_t ledIndex,
+                                       uint8_t redChannel, uint8_t greenChannel,
+                                       uint8_t blueChannel, uint8_t alphaChannel) {
+    // Make sure the LED is on the strip
+    if(ledIndex >= this->ledCount)
+        return;
+
+    // Set the color, and mark the LED as dirty if it changed
+    uint32_t combined = LedStripColor(redChannel, greenChannel, blueChannel, alphaChannel).getCombinedChannels();
+    if(this->leds[ledIndex].getCombinedChannels() != combined) {
+        this->leds[ledIndex].setCombinedChannels(combined);
+        this->markDirty(ledIndex, ledIndex + 1, 1);
+    }
+}
+
+uint32_t LedStripAdapterLayer::getLedColorCombinedChannels(uint16_t ledIndex) {
+    return this->getLedColor(ledIndex).getCombinedChannels();
+}
+
+void LedStripAdapterLayer::setLedColorCombinedChannels(uint16_t ledIndex, uint32_t combinedColorValue) {
+    this->setLedColor(ledIndex, LedStripColor::fromCombinedChannels(combinedColorValue));
+}
+
+uint8_t LedStripAdapterLayer::getColorChannelCount() {
+    return LAYER_COLOR_CHANNEL_COUNT;
+}
+
+uint8_t LedStripAdapterLayer::getColorValueMax() {
+    return LAYER_COLOR_VALUE_MAX;
+}
\ No newline at end of file
@@ -0,0 +1,177 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPADAPTERLAYER_H
+#define LEDSTRIPDRIVER_LEDSTRIPADAPTERLAYER_H
+
+#include "LedStripColor.h"
+#include "LedStripAdapterBase.h"
+
+#define LAYER_COLOR_CHANNEL_COUNT 4
+#define LAYER_COLOR_VALUE_MAX 255
+
+/**
+ * Blend modes of a layer, combining the layer color with the color of the layers below.
+ * Normal replaces the color, add sums the channels, multiply darkens and screen lightens. The result is mixed with the
+ * color below by the alpha channel of the layer color and the layer opacity.
+ */
+#define LED_STRIP_LAYER_BLEND_NORMAL 0
+#define LED_STRIP_LAYER_BLEND_ADD 1
+#define LED_STRIP_LAYER_BLEND_MULTIPLY 2
+#define LED_STRIP_LAYER_BLEND_SCREEN 3
+
+/**
+ * LED strip adapter of a compositor layer, which doesn't drive any hardware.
+ * The RGBA colors are kept in memory, for LedStripCompositor to blend with the other layers. The changed range is
+ * tracked as for other adapters, so the compositor only blends changed LEDs.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripAdapterLayer : public LedStripAdapterBase {
+private:
+    /**
+     * Number of LEDs.
+     */
+    uint16_t ledCount;
+
+    /**
+     * Current LED colors, transparent black by default.
+     */
+    LedStripColor* leds;
+
+    /**
+     * Blend mode, see LED_STRIP_LAYER_BLEND_NORMAL.
+     */
+    uint8_t blendMode;
+
+    /**
+     * Opacity of the whole layer, multiplied with the alpha channel of each LED.
+     */
+    uint8_t opacity;
+
+    /**
+     * Allocate the LED buffer for the current LED count, and clear it.
+     */
+    void allocate();
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param ledCount Number of LEDs.
+     * @param blendMode Blend mode, see LED_STRIP_LAYER_BLEND_NORMAL.
+     */
+    LedStripAdapterLayer(uint16_t ledCount, uint8_t blendMode);
+
+    /**
+     * Destructor.
+     */
+    ~LedStripAdapterLayer();
+
+    /**
+     * Get the LED colors, for blending.
+     *
+     * @return LED colors.
+     */
+    LedStripColor* getLayerColors();
+
+    /**
+     * Get the blend mode.
+     *
+     * @return Blend mode.
+     */
+    uint8_t getBlendMode();
+
+    /**
+     * Set the blend mode.
+     *
+     * @param blendMode Blend mode, see LED_STRIP_LAYER_BLEND_NORMAL.
+     */
+    void setBlendMode(uint8_t blendMode);
+
+    /**
+     * Get the opacity of the whole layer.
+     *
+     * @return Opacity, 0 for invisible up to 255 for the alpha channel of each LED only.
+     */
+    uint8_t getOpacity();
+
+    /**
+     * Set the opacity of the whole layer.
+     *
+     * @param opacity Opacity, 0 for invisible up to 255 for the alpha channel of each LED only.
+     */
+    void setOpacity(uint8_t opacity);
+
+    /**
+     * Mark the layer as blended by the compositor, which clears the changed range.
+     */
+    void markComposited();
+
+    // Override virtual method in BaseLedStripAdapter class
+    void init();
+
+    // Override virtual method in BaseLedStripAdapter class
+    void init(bool render);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void render();
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint16_t getLedCount();
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedCount(uint16_t ledCount);
+
+    // Override virtual method in BaseLedStripAdapter class
+    LedStripColor getLedColor(uint16_t ledIndex);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, LedStripColor color);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel, uint8_t alphaChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint32_t getLedColorCombinedChannels(uint16_t ledIndex);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColorCombinedChannels(uint16_t ledIndex, uint32_t combinedColorValue);
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint8_t getColorChannelCount();
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint8_t getColorValueMax();
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPADAPTERLAYER_H
\ No newline at end of file
@@ -0,0 +1,220 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripAdapterSK6812.h"
+
+#ifdef WS2812_PIN_OUTPUT
+LedStripAdapterSK6812::LedStripAdapterSK6812(uint16_t ledCount, uint8_t pin) :
+        LedStripAdapterWS2812(ledCount, pin, 0, LedStripPixelSK6812::BYTES_PER_PIXEL) {
+    this->whiteExtraction = false;
+}
+#endif
+
+LedStripAdapterSK6812::LedStripAdapterSK6812(uint16_t ledCount) :
+        LedStripAdapterWS2812(ledCount, 0, WS2812_SPI_BITS_DEFAULT, LedStripPixelSK6812::BYTES_PER_PIXEL) {
+    this->whiteExtraction = false;
+}
+
+bool LedStripAdapterSK6812::writePixel(uint8_t* pixel, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel) {
+    // Encode the pixel, and compare it as a whole against the current one
+    uint8_t native[LedStripPixelSK6812::BYTES_PER_PIXEL];
+    if(this->whiteExtraction)
+        LedStripPixelSK6812::encodeExtractWhite(native, redChannel, greenChannel, blueChannel);
+    else
+        LedStripPixelSK6812::encode(native, redChannel, greenChannel, blueChannel, 0);
+    if(memcmp(pixel, native, LedStripPixelSK6812::BYTES_PER_PIXEL) == 0)
+        return false;
+
+    memcpy(pixel, native, LedStripPixelSK6812::BYTES_PER_PIXEL);
+    return true;
+}
+
+bool LedStripAdapterSK6812::isWhiteExtraction() {
+    return this->whiteExtraction;
+}
+
+void LedStripAdapterSK6812::setWhiteExtraction(bool whiteExtraction) {
+    // Nothing to encode again if the setting doesn't change
+    if(this->whiteExtraction == whiteExtraction)
+        return;
+    this->whiteExtraction = whiteExtraction;
+
+    // Encode the current colors again for the new setting, with their white channel added in
+    uint8_t* pixel = this->pixels;
+    uint16_t changedFrom = this->ledCount, changedTo = 0, changedCount = 0;
+    for(uint16_t i = 0; i < this->ledCount; i++, pixel += LedStripPixelSK6812::BYTES_PER_PIXEL) {
+        LedStripColor color = LedStripPixelSK6812::decodeMergeWhite(pixel);
+        if(this->writePixel(pixel, color.getRed(), color.getGreen(), color.getBlue())) {
+            if(changedCount++ == 0)
+                changedFrom = i;
+            changedTo = i + 1;
+        }
+    }
+
+    // Mark the changed range as dirty
+    this->markDirty(changedFrom, changedTo, changedCount);
+}
+
+uint8_t LedStripAdapterSK6812::getLedWhite(uint16_t ledIndex) {
+    // Make sure the LED is on the strip
+    if(ledIndex >= this->ledCount)
+        return 0;
+
+    return this->pixels[ledIndex * LedStripPixelSK6812::BYTES_PER_PIXEL + LedStripPixelSK6812::WHITE_INDEX];
+}
+
+void LedStripAdapterSK6812::setLedColorRgbw(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel,
+                                            uint8_t blueChannel, uint8_t whiteChannel) {
+    // Make sure the LED is on the strip
+    if(ledIndex >= this->ledCount)
+        return;
+
+    // Write the pixel, and mark the LED as dirty if it changed
+    uint8_t* pixel = &this->pixels[ledIndex * LedStripPixelSK6812::BYTES_PER_PIXEL];
+    uint8_t native[LedStripPixelSK6812::BYTES_PER_PIXEL];
+    LedStripPixelSK6812::encode(native, redChannel, greenChannel, blueChannel, whiteChannel);
+    if(memcmp(pixel, native, LedStripPixelSK6812::BYTES_PER_PIXEL) != 0) {
+        memcpy(pixel, native, LedStripPixelSK6812::BYTES_PER_PIXEL);
+        this->markDirty(ledIndex, ledIndex + 1, 1);
+    }
+}
+
+LedStripColor LedStripAdapterSK6812::getLedColor(uint16_t ledIndex) {
+    // Make sure the LED is on the strip
+    if(ledIndex >= this->ledCount)
+        return LedStripColor::black();
+
+    // Add the white channel back in if it was extracted
+    uint8_t* pixel = &this->pixels[ledIndex * LedStripPixelSK6812::BYTES_PER_PIXEL];
+    if(this->whiteExtraction)
+        return LedStripPixelSK6812::decodeMergeWhite(pixel);
+    return LedStripPixelSK6812::decode(pixel);
+}
+
+void LedStripAdapterSK6812::setLedColor(uint16_t ledIndex, uint8_t redChannel) {
+    // An extracted white channel depends on all color channels, so the whole color is written again
+    if(this->whiteExtraction) {
+        LedStripAdapterWS2812::setLedColor(ledIndex, redChannel);
+        return;
+    }
+
+    // Make sure the LED is on the strip
+    if(ledIndex >= this->ledCount)
+        return;
+
+    // Only write the red channel, and keep the others including the white channel
+    uint8_t* pixel = &this->pixels[ledIndex * LedStripPixelSK6812::BYTES_PER_PIXEL];
+    if(pixel[LedStripPixelSK6812::RED_INDEX] != redChannel) {
+        pixel[LedStripPixelSK6812::RED_INDEX] = redChannel;
+        this->markDirty(ledIndex, ledIndex + 1, 1);
+    }
+}
+
+void LedStripAdapterSK6812::setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel) {
+    // An extracted white channel depends on all color channels, so the whole color is written again
+    if(this->whiteExtraction) {
+        LedStripAdapterWS2812::setLedColor(ledIndex, redChannel, greenChannel);
+        return;
+    }
+
+    // Make sure the LED is on the strip
+    if(ledIndex >= this->ledCount)
+        return;
+
+    // Only write the red and green channel, and keep the others including the white channel
+    uint8_t* pixel = &this->pixels[ledIndex * LedStripPixelSK6812::BYTES_PER_PIXEL];
+    if(pixel[LedStripPixelSK6812::RED_INDEX] != redChannel || pixel[LedStripPixelSK6812::GREEN_INDEX] != greenChannel) {
+        pixel[LedStripPixelSK6812::RED_INDEX] = redChannel;
+        pixel[LedStripPixelSK6812::GREEN_INDEX] = greenChannel;
+        this->markDirty(ledIndex, ledIndex + 1, 1);
+    }
+}
+
+void LedStripAdapterSK6812::setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel,
+                                        uint8_t blueChannel) {
+    // Make sure the LED is on the strip
+    if(ledIndex >= this->ledCount)
+        return;
+
+    // Write the pixel, and mark the LED as dirty if it changed
+    if(this->writePixel(&this->pixels[ledIndex * LedStripPixelSK6812::BYTES_PER_PIXEL],
+                        redChannel, greenChannel, blueChannel))
+        this->markDirty(ledIndex, ledIndex + 1, 1);
+}
+
+void LedStripAdapterSK6812::setLedColors(uint16_t fromLedIndex, LedStripColor* colors, uint16_t count) {
+    // Clip the span to the strip once, instead of bounds checking each LED
+    if(fromLedIndex >= this->ledCount)
+        return;
+    if(count > this->ledCount - fromLedIndex)
+        count = this->ledCount - fromLedIndex;
+
+    // Write the colors straight into the pixel buffer, and keep track of the changed range
+    uint8_t* pixel = &this->pixels[fromLedIndex * LedStripPixelSK6812::BYTES_PER_PIXEL];
+    uint16_t changedFrom = count, changedTo = 0, changedCount = 0;
+    for(uint16_t i = 0; i < count; i++, pixel += LedStripPixelSK6812::BYTES_PER_PIXEL) {
+        if(this->writePixel(pixel, colors[i].getRed(), colors[i].getGreen(), colors[i].getBlue())) {
+            if(changedCount++ == 0)
+                changedFrom = i;
+            changedTo = i + 1;
+        }
+    }
+
+    // Mark the changed range as dirty
+    this->markDirty(fromLedIndex + changedFrom, fromLedIndex + changedTo, changedCount);
+}
+
+void LedStripAdapterSK6812::setLedColorsCombinedChannels(uint16_t fromLedIndex, uint32_t* combinedColorValues,
+                                                         uint16_t count) {
+    // Clip the span to the strip once, instead of bounds checking each LED
+    if(fromLedIndex >= this->ledCount)
+        return;
+    if(count > this->ledCount - fromLedIndex)
+        count = this->ledCount - fromLedIndex;
+
+    // Write the colors straight into the pixel buffer, and keep track of the changed range
+    uint8_t* pixel = &this->pixels[fromLedIndex * LedStripPixelSK6812::BYTES_PER_PIXEL];
+    uint16_t changedFrom = count, changedTo = 0, changedCount = 0;
+    for(uint16_t i = 0; i < count; i++, pixel += LedStripPixelSK6812::BYTES_PER_PIXEL) {
+        uint32_t combinedColorValue = combinedColorValues[i];
+        if(this->writePixel(pixel,
+                            (uint8_t) (combinedColorValue >> 24),
+                            (uint8_t) (combinedColorValue >> 16),
+                            (uint8_t) (combinedColorValue >> 8))) {
+            if(changedCount++ == 0)
+                changedFrom = i;
+            changedTo = i + 1;
+        }
+    }
+
+    // Mark the changed range as dirty
+    this->markDirty(fromLedIndex + changedFrom, fromLedIndex + changedTo, changedCount);
+}
+
+bool LedStripAdapterSK6812::getPixelFormat(LedStripPixelFormat* format) {
+    *format = LedStripPixelSK6812::getFormat();
+    return true;
+}
+
+bool LedStripAdapterSK6812::hasWhiteChannelSupport() {
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPADAPTERSK6812_H
+#define LEDSTRIPDRIVER_LEDSTRIPADAPTERSK6812_H
+
+#include "LedStripAdapterWS2812.h"
+#include "LedStripPixelSK6812.h"
+
+/**
+ * LED strip adapter for SK6812 RGBW type LED strips.
+ * These strips use the WS2812 timing, with a fourth byte per LED for the white emitter. The white channel is set
+ * explicitly through setLedColorRgbw(), or extracted from RGB colors when white extraction is enabled.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripAdapterSK6812 : public LedStripAdapterWS2812 {
+private:
+    /**
+     * True if the white channel is extracted from RGB colors.
+     */
+    bool whiteExtraction;
+
+    /**
+     * Write a color into a native pixel, extracting the white channel if enabled.
+     *
+     * @param pixel Native pixel.
+     * @param redChannel Color value of the red channel.
+     * @param greenChannel Color value of the green channel.
+     * @param blueChannel Color value of the blue channel.
+     *
+     * @return True if the pixel changed, false if it already had this color.
+     */
+    bool writePixel(uint8_t* pixel, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel);
+
+public:
+#ifdef WS2812_PIN_OUTPUT
+    /**
+     * Constructor, for strips driven directly from a pin.
+     *
+     * @param ledCount Number of LEDs.
+     * @param pin Data pin.
+     */
+    LedStripAdapterSK6812(uint16_t ledCount, uint8_t pin);
+#endif
+
+    /**
+     * Constructor, for strips on the MOSI pin of the hardware SPI bus.
+     *
+     * @param ledCount Number of LEDs.
+     */
+    LedStripAdapterSK6812(uint16_t ledCount);
+
+    /**
+     * Check whether the white channel is extracted from RGB colors.
+     *
+     * @return True if enabled, false if not.
+     */
+    bool isWhiteExtraction();
+
+    /**
+     * Enable or disable white extraction.
+     * When enabled, the part of an RGB color shared by all three channels is shown by the white emitter instead, see
+     * LedStripPixelSK6812::encodeExtractWhite(). Reading an LED color adds the white channel back in. When disabled,
+     * RGB colors turn the white emitter off, and reading an LED color ignores the white channel. Setting only the red,
+     * or the red and green channel, keeps the white channel as it is.
+     * The current LED colors are encoded again for the new setting, with their white channel added into the color
+     * channels, so they keep showing about the same light and are read back the same way.
+     *
+     * @param whiteExtraction True to enable, false to disable.
+     */
+    void setWhiteExtraction(bool whiteExtraction);
+
+    /**
+     * Get the white channel of an LED.
+     *
+     * @param ledIndex LED index.
+     *
+     * @return White value, 0 if the LED isn't on the strip.
+     */
+    uint8_t getLedWhite(uint16_t ledIndex);
+
+    /**
+     * Set the color of an LED, including its white channel.
+     * The white channel is written as given, regardless of white extraction.
+     *
+     * @param ledIndex LED index.
+     * @param redChannel Color value of the red channel.
+     * @param greenChannel Color value of the green channel.
+     * @param blueChannel Color value of the blue channel.
+     * @param whiteChannel Color value of the white channel.
+     */
+    void setLedColorRgbw(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel,
+                         uint8_t whiteChannel);
+
+    // The remaining setLedColor() overloads forward to the ones overridden here
+    using LedStripAdapterWS2812::setLedColor;
+
+    // Override virtual method in BaseLedStripAdapter class
+    LedStripColor getLedColor(uint16_t ledIndex);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColors(uint16_t fromLedIndex, LedStripColor* colors, uint16_t count);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColorsCombinedChannels(uint16_t fromLedIndex, uint32_t* combinedColorValues, uint16_t count);
+
+    // Override virtual method in BaseLedStripAdapter class
+    bool getPixelFormat(LedStripPixelFormat* format);
+
+    // Override virtual method in BaseLedStripAdapter class
+    bool hasWhiteChannelSupport();
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPADAPTERSK6812_H
\ No newline at end of file
@@ -0,0 +1,247 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripAdapterSegment.h"
+
+LedStripAdapterSegment::LedStripAdapterSegment(LedStripAdapterBase* parent, uint16_t offset, uint16_t length,
+                                               bool reversed) {
+    // Set the fields
+    this->parent = parent;
+    this->offset = offset;
+    this->length = length;
+    this->reversed = reversed;
+}
+
+LedStripAdapterBase* LedStripAdapterSegment::getParent() {
+    return this->parent;
+}
+
+uint16_t LedStripAdapterSegment::getOffset() {
+    return this->offset;
+}
+
+void LedStripAdapterSegment::setOffset(uint16_t offset) {
+    this->offset = offset;
+}
+
+bool LedStripAdapterSegment::isReversed() {
+    return this->reversed;
+}
+
+void LedStripAdapterSegment::setReversed(bool reversed) {
+    this->reversed = reversed;
+}
+
+bool LedStripAdapterSegment::mapRange(uint16_t* fromLedIndex, uint16_t* toLedIndex) {
+    // Clip the range to the segment
+    uint16_t from = *fromLedIndex;
+    uint16_t to = *toLedIndex < this->length ? *toLedIndex : this->length;
+    if(to <= from)
+        return false;
+
+    // Map the range to the parent, a reversed range is mirrored within the segment
+    if(this->reversed) {
+        *fromLedIndex = this->offset + this->length - to;
+        *toLedIndex = this->offset + this->length - from;
+    } else {
+        *fromLedIndex = this->offset + from;
+        *toLedIndex = this->offset + to;
+    }
+    return true;
+}
+
+void LedStripAdapterSegment::init() { }
+
+void LedStripAdapterSegment::init(bool render) {
+    // Render the LED strip
+    if(render)
+        this->render();
+}
+
+void LedStripAdapterSegment::render() {
+    this->parent->render();
+    this->markRendered();
+}
+
+void LedStripAdapterSegment::renderAsync() {
+    this->parent->renderAsync();
+    this->markRendered();
+}
+
+bool LedStripAdapterSegment::isRenderComplete() {
+    return this->parent->isRenderComplete();
+}
+
+void LedStripAdapterSegment::present() {
+    this->parent->present();
+    this->markRendered();
+}
+
+uint16_t LedStripAdapterSegment::getLedCount() {
+    return this->length;
+}
+
+void LedStripAdapterSegment::setLedCount(uint16_t ledCount) {
+    this->length = ledCount;
+}
+
+LedStripColor LedStripAdapterSegment::getLedColor(uint16_t ledIndex) {
+    // Make sure the LED is in the segment
+    if(ledIndex >= this->length)
+        return LedStripColor::black();
+
+    return this->parent->getLedColor(this->mapLedIndex(ledIndex));
+}
+
+void LedStripAdapterSegment::setLedColor(uint16_t ledIndex, LedStripColor color) {
+    if(ledIndex >= this->length)
+        return;
+
+    this->parent->setLedColor(this->mapLedIndex(ledIndex), color);
+    this->markDirty(ledIndex, ledIndex + 1, 1);
+}
+
+void LedStripAdapterSegment::setLedColor(uint16_t ledIndex, uint8_t redChannel) {
+    if(ledIndex >= this->length)
+        return;
+
+    this->parent->setLedColor(this->mapLedIndex(ledIndex), redChannel);
+    this->markDirty(ledIndex, ledIndex + 1, 1);
+}
+
+void LedStripAdapterSegment::setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel) {
+    if(ledIndex >= this->length)
+        return;
+
+    this->parent->setLedColor(this->mapLedIndex(ledIndex), redChannel, greenChannel);
+    this->markDirty(ledIndex, ledIndex + 1, 1);
+}
+
+void LedStripAdapterSegment::setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel,
+                                         uint8_t blueChannel) {
+    if(ledIndex >= this->length)
+        return;
+
+    this->parent->setLedColor(this->mapLedIndex(ledIndex), redChannel, greenChannel, blueChannel);
+    this->markDirty(ledIndex, ledIndex + 1, 1);
+}
+
+void LedStripAdapterSegment::setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel,
+                                         uint8_t blueChannel, uint8_t alphaChannel) {
+    if(ledIndex >= this->length)
+        return;
+
+    this->parent->setLedColor(this->mapLedIndex(ledIndex), redChannel, greenChannel, blueChannel, alphaChannel);
+    this->markDirty(ledIndex, ledIndex + 1, 1);
+}
+
+uint32_t LedStripAdapterSegment::getLedColorCombinedChannels(uint16_t ledIndex) {
+    // Make sure the LED is in the segment
+    if(ledIndex >= this->length)
+        return 0;
+
+    return this->parent->getLedColorCombinedChannels(this->mapLedIndex(ledIndex));
+}
+
+void LedStripAdapterSegment::setLedColorCombinedChannels(uint16_t ledIndex, uint32_t combinedColorValue) {
+    if(ledIndex >= this->length)
+        return;
+
+    this->parent->setLedColorCombinedChannels(this->mapLedIndex(ledIndex), combinedColorValue);
+    this->markDirty(ledIndex, ledIndex + 1, 1);
+}
+
+void LedStripAdapterSegment::setLedColors(uint16_t fromLedIndex, LedStripColor* colors, uint16_t count) {
+    // Clip the span to the segment
+    if(fromLedIndex >= this->length)
+        return;
+    if(count > this->length - fromLedIndex)
+        count = this->length - fromLedIndex;
+
+    // Forward spans are written to the parent in one go
+    if(!this->reversed) {
+        this->parent->setLedColors(this->offset + fromLedIndex, colors, count);
+        this->markDirty(fromLedIndex, fromLedIndex + count, count);
+        return;
+    }
+
+    // Reversed spans are mirrored chunk by chunk, and written to the parent in bulk
+    LedStripColor chunk[LED_STRIP_ADAPTER_CHUNK_SIZE];
+    for(uint16_t i = 0; i < count; i += LED_STRIP_ADAPTER_CHUNK_SIZE) {
+        uint16_t chunkCount = count - i < LED_STRIP_ADAPTER_CHUNK_SIZE ? count - i : LED_STRIP_ADAPTER_CHUNK_SIZE;
+        for(uint16_t j = 0; j < chunkCount; j++)
+            chunk[j] = colors[i + chunkCount - 1 - j];
+        this->parent->setLedColors(this->mapLedIndex(fromLedIndex + i + chunkCount - 1), chunk, chunkCount);
+    }
+    this->markDirty(fromLedIndex, fromLedIndex + count, count);
+}
+
+void LedStripAdapterSegment::setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, LedStripColor color) {
+    // Map the range to the parent, a single color is the same in both directions
+    uint16_t parentFrom = fromLedIndex, parentTo = toLedIndex;
+    if(!this->mapRange(&parentFrom, &parentTo))
+        return;
+
+    this->parent->setRangeLedColors(parentFrom, parentTo, color);
+    this->markDirty(fromLedIndex, fromLedIndex + (parentTo - parentFrom), parentTo - parentFrom);
+}
+
+void LedStripAdapterSegment::setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, uint8_t redChannel,
+                                               uint8_t greenChannel, uint8_t blueChannel) {
+    // Map the range to the parent, a single color is the same in both directions
+    uint16_t parentFrom = fromLedIndex, parentTo = toLedIndex;
+    if(!this->mapRange(&parentFrom, &parentTo))
+        return;
+
+    this->parent->setRangeLedColors(parentFrom, parentTo, redChannel, greenChannel, blueChannel);
+    this->markDirty(fromLedIndex, fromLedIndex + (parentTo - parentFrom), parentTo - parentFrom);
+}
+
+void LedStripAdapterSegment::setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, uint8_t redChannel,
+                                               uint8_t greenChannel, uint8_t blueChannel, uint8_t alphaChannel) {
+    // Map the range to the parent, a single color is the same in both directions
+    uint16_t parentFrom = fromLedIndex, parentTo = toLedIndex;
+    if(!this->mapRange(&parentFrom, &parentTo))
+        return;
+
+    this->parent->setRangeLedColors(parentFrom, parentTo, redChannel, greenChannel, blueChannel, alphaChannel);
+    this->markDirty(fromLedIndex, fromLedIndex + (parentTo - parentFrom), parentTo - parentFrom);
+}
+
+void LedStripAdapterSegment::setRangeLedColorsCombinedChannels(uint16_t fromLedIndex, uint16_t toLedIndex,
+                                                               uint32_t combinedColorValue) {
+    // Map the range to the parent, a single color is the same in both directions
+    uint16_t parentFrom = fromLedIndex, parentTo = toLedIndex;
+    if(!this->mapRange(&parentFrom, &parentTo))
+        return;
+
+    this->parent->setRangeLedColorsCombinedChannels(parentFrom, parentTo, combinedColorValue);
+    this->markDirty(fromLedIndex, fromLedIndex + (parentTo - parentFrom), parentTo - parentFrom);
+}
+
+uint8_t LedStripAdapterSegment::getColorChannelCount() {
+    return this->parent->getColorChannelCount();
+}
+
+uint8_t LedStripAdapterSegment::getColorValueMax() {
+    return this->parent->getColorValueMax();
+}
\ No newline at end of file
@@ -0,0 +1,211 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPADAPTERSEGMENT_H
+#define LEDSTRIPDRIVER_LEDSTRIPADAPTERSEGMENT_H
+
+#include "LedStripColor.h"
+#include "LedStripAdapterBase.h"
+
+/**
+ * LED strip adapter for a segment of another LED strip.
+ * Segment LED indices are mapped onto a range of the parent adapter, optionally in reversed direction. The segment
+ * doesn't have a buffer of its own, all writes go straight to the parent adapter.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripAdapterSegment : public LedStripAdapterBase {
+private:
+    /**
+     * Adapter of the parent LED strip.
+     */
+    LedStripAdapterBase* parent;
+
+    /**
+     * Index of the first LED of the segment on the parent.
+     */
+    uint16_t offset;
+
+    /**
+     * Number of LEDs in the segment.
+     */
+    uint16_t length;
+
+    /**
+     * True if the segment runs in reversed direction on the parent.
+     */
+    bool reversed;
+
+    /**
+     * Map a segment LED index to the parent LED index.
+     *
+     * @param ledIndex Segment LED index, must be in range.
+     *
+     * @return Parent LED index.
+     */
+    inline uint16_t mapLedIndex(uint16_t ledIndex) {
+        return this->reversed ? this->offset + this->length - 1 - ledIndex : this->offset + ledIndex;
+    }
+
+    /**
+     * Clip a segment LED range to the segment, and map it to the parent.
+     *
+     * @param fromLedIndex Segment from LED index, returns the parent from LED index.
+     * @param toLedIndex Segment to LED index (excluded), returns the parent to LED index. (excluded)
+     *
+     * @return True if part of the range is in the segment, false if not.
+     */
+    bool mapRange(uint16_t* fromLedIndex, uint16_t* toLedIndex);
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param parent Adapter of the parent LED strip.
+     * @param offset Index of the first LED of the segment on the parent.
+     * @param length Number of LEDs in the segment.
+     * @param reversed True if the segment runs in reversed direction on the parent, false if not.
+     */
+    LedStripAdapterSegment(LedStripAdapterBase* parent, uint16_t offset, uint16_t length, bool reversed);
+
+    /**
+     * Get the adapter of the parent LED strip.
+     *
+     * @return Parent adapter.
+     */
+    LedStripAdapterBase* getParent();
+
+    /**
+     * Get the index of the first LED of the segment on the parent.
+     *
+     * @return Offset.
+     */
+    uint16_t getOffset();
+
+    /**
+     * Move the segment on the parent.
+     *
+     * @param offset Index of the first LED of the segment on the parent.
+     */
+    void setOffset(uint16_t offset);
+
+    /**
+     * Check whether the segment runs in reversed direction on the parent.
+     *
+     * @return True if reversed, false if not.
+     */
+    bool isReversed();
+
+    /**
+     * Set whether the segment runs in reversed direction on the parent.
+     *
+     * @param reversed True if reversed, false if not.
+     */
+    void setReversed(bool reversed);
+
+    /**
+     * The parent LED strip is initialized by its owner, so this does nothing.
+     */
+    void init();
+
+    /**
+     * The parent LED strip is initialized by its owner, so this only renders if requested.
+     *
+     * @param render True to render once, false if not.
+     */
+    void init(bool render);
+
+    /**
+     * Render the parent LED strip.
+     * When several segments of a strip are drawn, rendering just one of them, or the parent, outputs all of them.
+     */
+    void render();
+
+    // Override virtual method in BaseLedStripAdapter class
+    void renderAsync();
+
+    // Override virtual method in BaseLedStripAdapter class
+    bool isRenderComplete();
+
+    // Override virtual method in BaseLedStripAdapter class
+    void present();
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint16_t getLedCount();
+
+    /**
+     * Resize the segment. The parent LED strip isn't changed.
+     *
+     * @param ledCount Number of LEDs in the segment.
+     */
+    void setLedCount(uint16_t ledCount);
+
+    // Override virtual method in BaseLedStripAdapter class
+    LedStripColor getLedColor(uint16_t ledIndex);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, LedStripColor color);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel, uint8_t alphaChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint32_t getLedColorCombinedChannels(uint16_t ledIndex);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColorCombinedChannels(uint16_t ledIndex, uint32_t combinedColorValue);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColors(uint16_t fromLedIndex, LedStripColor* colors, uint16_t count);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, LedStripColor color);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, uint8_t redChannel, uint8_t greenChannel,
+                           uint8_t blueChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, uint8_t redChannel, uint8_t greenChannel,
+                           uint8_t blueChannel, uint8_t alphaChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setRangeLedColorsCombinedChannels(uint16_t fromLedIndex, uint16_t toLedIndex, uint32_t combinedColorValue);
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint8_t getColorChannelCount();
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint8_t getColorValueMax();
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPADAPTERSEGMENT_H
\ No newline at end of file
@@ -0,0 +1,175 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripAdapterSimulated.h"
+
+LedStripAdapterSimulated::LedStripAdapterSimulated(uint16_t ledCount) : LedStripAdapterSimulated(ledCount, 1) { }
+
+LedStripAdapterSimulated::LedStripAdapterSimulated(uint16_t ledCount, uint8_t frameCapacity) {
+    // Set the fields
+    this->ledCount = ledCount;
+    this->frameCapacity = frameCapacity > 0 ? frameCapacity : 1;
+    this->leds = NULL;
+    this->frames = NULL;
+
+    // Allocate the buffers, and make sure the first render records a frame
+    this->allocate();
+    this->invalidate();
+}
+
+LedStripAdapterSimulated::~LedStripAdapterSimulated() {
+    // Explicitly delete the dynamically allocated buffers
+    delete[] this->leds;
+    delete[] this->frames;
+}
+
+void LedStripAdapterSimulated::allocate() {
+    // Delete the previous buffers
+    delete[] this->leds;
+    delete[] this->frames;
+
+    // Allocate the new buffers, colors default to black
+    this->leds = new LedStripColor[this->ledCount];
+    this->frames = new LedStripColor[(uint32_t) this->ledCount * this->frameCapacity];
+    this->frameCount = 0;
+}
+
+uint32_t LedStripAdapterSimulated::getFrameCount() {
+    return this->frameCount;
+}
+
+uint8_t LedStripAdapterSimulated::getFrameCapacity() {
+    return this->frameCapacity;
+}
+
+LedStripColor LedStripAdapterSimulated::getFrameLedColor(uint8_t frameAge, uint16_t ledIndex) {
+    // Make sure the frame is recorded, and the LED exists
+    if(frameAge >= this->frameCapacity || frameAge >= this->frameCount || ledIndex >= this->ledCount)
+        return LedStripColor::black();
+
+    // Find the frame in the ring buffer
+    uint8_t slot = (this->frameCount - 1 - frameAge) % this->frameCapacity;
+    return this->frames[(uint32_t) slot * this->ledCount + ledIndex];
+}
+
+void LedStripAdapterSimulated::init() { }
+
+void LedStripAdapterSimulated::init(bool render) {
+    // Render the LED strip
+    if(render)
+        this->render();
+}
+
+void LedStripAdapterSimulated::render() {
+    // Skip rendering if nothing has changed since the last frame
+    if(!this->isDirty())
+        return;
+
+    // Record the frame in the next ring buffer slot, through the copy assignment of each color
+    LedStripColor* frame = &this->frames[(uint32_t) (this->frameCount % this->frameCapacity) * this->ledCount];
+    for(uint16_t i = 0; i < this->ledCount; i++)
+        frame[i] = this->leds[i];
+    this->frameCount++;
+    this->markRendered();
+}
+
+uint16_t LedStripAdapterSimulated::getLedCount() {
+    return this->ledCount;
+}
+
+void LedStripAdapterSimulated::setLedCount(uint16_t ledCount) {
+    // Reallocate the buffers, and make sure the resized strip is rendered
+    this->ledCount = ledCount;
+    this->allocate();
+    this->invalidate();
+}
+
+LedStripColor LedStripAdapterSimulated::getLedColor(uint16_t ledIndex) {
+    // Make sure the LED is on the strip
+    if(ledIndex >= this->ledCount)
+        return LedStripColor::black();
+
+    return this->leds[ledIndex];
+}
+
+void LedStripAdapterSimulated::setLedColor(uint16_t ledIndex, LedStripColor color) {
+    this->setLedColor(ledIndex, color.getRed(), color.getGreen(), color.getBlue(), color.getAlpha());
+}
+
+void LedStripAdapterSimulated::setLedColor(uint16_t ledIndex, uint8_t redChannel) {
+    // Get the color of the LED
+    LedStripColor ledColor = this->getLedColor(ledIndex);
+
+    // Set the red channel
+    ledColor.setRed(redChannel);
+
+    // Update the led color
+    this->setLedColor(ledIndex, ledColor);
+}
+
+void LedStripAdapterSimulated::setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel) {
+    // Get the color of the LED
+    LedStripColor ledColor = this->getLedColor(ledIndex);
+
+    // Set the red and green channel
+    ledColor.setRed(redChannel);
+    ledColor.setGreen(greenChannel);
+
+    // Update the led color
+    this->setLedColor(ledIndex, ledColor);
+}
+
+void LedStripAdapterSimulated::setLedColor(uint16_t ledIndex,
+                                           uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel) {
+    this->setLedColor(ledIndex, redChannel, greenChannel, blueChannel, (uint8_t) LED_STRIP_COLOR_VALUE_MAX);
+}
+
+void LedStripAdapterSimulated::setLedColor(uint16_t ledIndex,
+                                           uint8_t redChannel, uint8_t greenChannel,
+                                           uint8_t blueChannel, uint8_t alphaChannel) {
+    // Make sure the LED is on the strip
+    if(ledIndex >= this->ledCount)
+        return;
+
+    // Set the color, and mark the LED as dirty if it changed
+    uint32_t combined = LedStripColor(redChannel, greenChannel, blueChannel, alphaChannel).getCombinedChannels();
+    if(this->leds[ledIndex].getCombinedChannels() != combined) {
+        this->leds[ledIndex].setCombinedChannels(combined);
+        this->markDirty(ledIndex, ledIndex + 1, 1);
+    }
+}
+
+uint32_t LedStripAdapterSimulated::getLedColorCombinedChannels(uint16_t ledIndex) {
+    return this->getLedColor(ledIndex).getCombinedChannels();
+}
+
+void LedStripAdapterSimulated::setLedColorCombinedChannels(uint16_t ledIndex, uint32_t combinedColorValue) {
+    this->setLedColor(ledIndex, LedStripColor::fromCombinedChannels(combinedColorValue));
+}
+
+uint8_t LedStripAdapterSimulated::getColorChannelCount() {
+    return SIMULATED_COLOR_CHANNEL_COUNT;
+}
+
+uint8_t LedStripAdapterSimulated::getColorValueMax() {
+    return SIMULATED_COLOR_VALUE_MAX;
+}
\ No newline at end of file
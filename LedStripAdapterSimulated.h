@@ -0,0 +1,164 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPADAPTERSIMULATED_H
+#define LEDSTRIPDRIVER_LEDSTRIPADAPTERSIMULATED_H
+
+#include "LedStripColor.h"
+#include "LedStripAdapterBase.h"
+
+#define SIMULATED_COLOR_CHANNEL_COUNT 4
+#define SIMULATED_COLOR_VALUE_MAX 255
+
+/**
+ * Simulated LED strip adapter, which doesn't drive any hardware.
+ * Rendered frames are recorded into memory instead, so the driver and animations can be tested and profiled off-target.
+ * The most recent frames are kept in a ring buffer, of which the capacity is configured on construction.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripAdapterSimulated : public LedStripAdapterBase {
+private:
+    /**
+     * Number of LEDs.
+     */
+    uint16_t ledCount;
+
+    /**
+     * Current LED colors.
+     */
+    LedStripColor* leds;
+
+    /**
+     * Maximum number of recorded frames.
+     */
+    uint8_t frameCapacity;
+
+    /**
+     * Recorded frames, frameCapacity frames of ledCount colors each.
+     */
+    LedStripColor* frames;
+
+    /**
+     * Total number of rendered frames.
+     */
+    uint32_t frameCount;
+
+    /**
+     * Allocate the LED and frame buffers for the current LED count.
+     */
+    void allocate();
+
+public:
+    /**
+     * Constructor.
+     * This records the last rendered frame only.
+     *
+     * @param ledCount Number of LEDs.
+     */
+    LedStripAdapterSimulated(uint16_t ledCount);
+
+    /**
+     * Constructor.
+     *
+     * @param ledCount Number of LEDs.
+     * @param frameCapacity Number of rendered frames to keep in memory, at least one.
+     */
+    LedStripAdapterSimulated(uint16_t ledCount, uint8_t frameCapacity);
+
+    /**
+     * Destructor.
+     */
+    ~LedStripAdapterSimulated();
+
+    /**
+     * Get the total number of rendered frames.
+     *
+     * @return Frame count.
+     */
+    uint32_t getFrameCount();
+
+    /**
+     * Get the number of rendered frames that are kept in memory.
+     *
+     * @return Frame capacity.
+     */
+    uint8_t getFrameCapacity();
+
+    /**
+     * Get the color of an LED in a recorded frame.
+     *
+     * @param frameAge Age of the frame, 0 for the last rendered frame, 1 for the frame before it, and so on.
+     * @param ledIndex Index of the LED.
+     *
+     * @return LED color, or black if the frame or LED isn't available.
+     */
+    LedStripColor getFrameLedColor(uint8_t frameAge, uint16_t ledIndex);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void init();
+
+    // Override virtual method in BaseLedStripAdapter class
+    void init(bool render);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void render();
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint16_t getLedCount();
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedCount(uint16_t ledCount);
+
+    // Override virtual method in BaseLedStripAdapter class
+    LedStripColor getLedColor(uint16_t ledIndex);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, LedStripColor color);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel, uint8_t alphaChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint32_t getLedColorCombinedChannels(uint16_t ledIndex);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColorCombinedChannels(uint16_t ledIndex, uint32_t combinedColorValue);
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint8_t getColorChannelCount();
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint8_t getColorValueMax();
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPADAPTERSIMULATED_H
\ No newline at end of file
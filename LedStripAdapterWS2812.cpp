@@ -0,0 +1,428 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "SPI.h"
+#include "LedStripAdapterWS2812.h"
+
+/**
+ * SPI bit patterns of each data nibble, with three SPI bits per data bit.
+ */
+static const uint16_t WS2812_SPI_PATTERN_3[16] PROGMEM = {
+    0x924, 0x926, 0x934, 0x936, 0x9A4, 0x9A6, 0x9B4, 0x9B6,
+    0xD24, 0xD26, 0xD34, 0xD36, 0xDA4, 0xDA6, 0xDB4, 0xDB6
+};
+
+/**
+ * SPI bit patterns of each data nibble, with four SPI bits per data bit.
+ */
+static const uint16_t WS2812_SPI_PATTERN_4[16] PROGMEM = {
+    0x8888, 0x888E, 0x88E8, 0x88EE, 0x8E88, 0x8E8E, 0x8EE8, 0x8EEE,
+    0xE888, 0xE88E, 0xE8E8, 0xE8EE, 0xEE88, 0xEE8E, 0xEEE8, 0xEEEE
+};
+
+LedStripAdapterWS2812::LedStripAdapterWS2812(uint16_t ledCount, uint8_t pin, uint8_t spiBitsPerBit,
+                                             uint8_t bytesPerPixel) {
+    // Set the fields
+    this->ledCount = ledCount;
+    this->bytesPerPixel = bytesPerPixel;
+    this->pixels = NULL;
+    this->pin = pin;
+    this->spiBitsPerBit = spiBitsPerBit;
+    this->encoded = NULL;
+#ifdef WS2812_PIN_OUTPUT
+    this->port = NULL;
+    this->pinMask = 0;
+#endif
+    this->frameEnd = 0;
+    this->transmitTime = 0;
+
+    // Allocate the buffers, the hardware state is unknown so make sure the first render outputs everything
+    this->allocate();
+    this->invalidate();
+}
+
+#ifdef WS2812_PIN_OUTPUT
+LedStripAdapterWS2812::LedStripAdapterWS2812(uint16_t ledCount, uint8_t pin) :
+        LedStripAdapterWS2812(ledCount, pin, 0, LedStripPixelWS2812::BYTES_PER_PIXEL) { }
+#endif
+
+LedStripAdapterWS2812::LedStripAdapterWS2812(uint16_t ledCount) :
+        LedStripAdapterWS2812(ledCount, 0, WS2812_SPI_BITS_DEFAULT, LedStripPixelWS2812::BYTES_PER_PIXEL) { }
+
+LedStripAdapterWS2812::~LedStripAdapterWS2812() {
+    // Explicitly delete the dynamically allocated buffers
+    free(this->pixels);
+    free(this->encoded);
+}
+
+void LedStripAdapterWS2812::allocate() {
+    // Delete the previous buffers
+    free(this->pixels);
+    free(this->encoded);
+    this->encoded = NULL;
+
+    // Allocate the zeroed pixel buffer, and the encoding buffer if the strip is on the SPI bus
+    uint32_t size = (uint32_t) this->ledCount * this->bytesPerPixel;
+    this->pixels = (uint8_t*) calloc(size, 1);
+    if(this->spiBitsPerBit != 0 && this->pixels != NULL)
+        this->encoded = (uint8_t*) malloc(size * this->spiBitsPerBit);
+
+    // Don't address LEDs that don't have a buffer
+    if(this->pixels == NULL || (this->spiBitsPerBit != 0 && this->encoded == NULL))
+        this->ledCount = 0;
+}
+
+bool LedStripAdapterWS2812::writePixel(uint8_t* pixel, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel) {
+    // Compare the pixel before writing, so unchanged LEDs aren't marked dirty
+    if(pixel[LedStripPixelWS2812::RED_INDEX] == redChannel &&
+       pixel[LedStripPixelWS2812::GREEN_INDEX] == greenChannel &&
+       pixel[LedStripPixelWS2812::BLUE_INDEX] == blueChannel)
+        return false;
+
+    LedStripPixelWS2812::encode(pixel, redChannel, greenChannel, blueChannel);
+    return true;
+}
+
+uint8_t LedStripAdapterWS2812::getSpiBitsPerBit() {
+    return this->spiBitsPerBit;
+}
+
+bool LedStripAdapterWS2812::setSpiBitsPerBit(uint8_t spiBitsPerBit) {
+    // Make sure the value is supported, and the strip is on the SPI bus
+    if(spiBitsPerBit != 3 && spiBitsPerBit != 4)
+        return false;
+    if(this->spiBitsPerBit == 0)
+        return false;
+    if(this->spiBitsPerBit == spiBitsPerBit)
+        return true;
+
+    // Reallocate the encoding buffer for the new size
+    uint8_t* encoded = (uint8_t*) malloc((uint32_t) this->ledCount * this->bytesPerPixel * spiBitsPerBit);
+    if(encoded == NULL)
+        return false;
+    free(this->encoded);
+    this->encoded = encoded;
+    this->spiBitsPerBit = spiBitsPerBit;
+    return true;
+}
+
+uint32_t LedStripAdapterWS2812::encodeSpiBits(const uint8_t* source, uint32_t size, uint8_t spiBitsPerBit,
+                                              uint8_t* target) {
+    uint8_t* ptr = target;
+
+    if(spiBitsPerBit == 3) {
+        // Each data byte becomes 24 SPI bits, two 12 bit nibble patterns
+        while(size--) {
+            uint8_t value = *source++;
+            uint16_t high = pgm_read_word(&WS2812_SPI_PATTERN_3[value >> 4]);
+            uint16_t low = pgm_read_word(&WS2812_SPI_PATTERN_3[value & 0x0F]);
+            *ptr++ = (uint8_t) (high >> 4);
+            *ptr++ = (uint8_t) (high << 4) | (uint8_t) (low >> 8);
+            *ptr++ = (uint8_t) low;
+        }
+
+    } else if(spiBitsPerBit == 4) {
+        // Each data byte becomes 32 SPI bits, two 16 bit nibble patterns
+        while(size--) {
+            uint8_t value = *source++;
+            uint16_t high = pgm_read_word(&WS2812_SPI_PATTERN_4[value >> 4]);
+            uint16_t low = pgm_read_word(&WS2812_SPI_PATTERN_4[value & 0x0F]);
+            *ptr++ = (uint8_t) (high >> 8);
+            *ptr++ = (uint8_t) high;
+            *ptr++ = (uint8_t) (low >> 8);
+            *ptr++ = (uint8_t) low;
+        }
+
+    } else
+        return 0;
+
+    return (uint32_t) (ptr - target);
+}
+
+void LedStripAdapterWS2812::init() {
+    this->init(false);
+}
+
+void LedStripAdapterWS2812::init(bool render) {
+    if(this->spiBitsPerBit != 0) {
+        // Enable the SPI hardware, the settings are applied for each frame
+        SPI.begin();
+
+    } else {
+#ifdef WS2812_PIN_OUTPUT
+        // Set up the pin, the data line idles low
+        pinMode(this->pin, OUTPUT);
+        digitalWrite(this->pin, LOW);
+
+        // Resolve the port register once, so each frame is written through it directly
+        this->port = portOutputRegister(digitalPinToPort(this->pin));
+        this->pinMask = digitalPinToBitMask(this->pin);
+#endif
+    }
+
+    // Render the LED strip
+    if(render) {
+        this->invalidate();
+        this->render();
+    }
+}
+
+void LedStripAdapterWS2812::render() {
+    // Skip rendering if nothing has changed since the last frame
+    if(!this->isDirty())
+        return;
+
+    // Make sure the previous frame has latched
+    while(micros() - this->frameEnd < WS2812_LATCH_TIME);
+
+    // Transmit the frame
+    unsigned long start = micros();
+    if(this->spiBitsPerBit != 0)
+        this->transmitSpi();
+    else
+        this->transmitPin();
+    this->frameEnd = micros();
+    this->transmitTime = this->frameEnd - start;
+    this->markRendered();
+}
+
+void LedStripAdapterWS2812::transmitSpi() {
+    // Encode the frame
+    uint32_t i = encodeSpiBits(this->pixels, (uint32_t) this->ledCount * this->bytesPerPixel,
+                               this->spiBitsPerBit, this->encoded);
+    uint8_t* ptr = this->encoded;
+
+#ifdef SPI_HAS_TRANSACTION
+    SPI.beginTransaction(SPISettings(this->spiBitsPerBit * WS2812_BIT_RATE, MSBFIRST, SPI_MODE0));
+#endif
+
+#if defined(__AVR__)
+    // Write SPDR directly, so the next byte is prepared while the prior one is shifted out
+    if(i) {
+        SPDR = *ptr++;
+        while(--i) {
+            uint8_t p = *ptr++;
+            while(!(SPSR & (1 << SPIF)));
+            SPDR = p;
+        }
+        while(!(SPSR & (1 << SPIF)));
+    }
+#else
+    while(i--)
+        SPI.transfer(*ptr++);
+#endif
+
+#ifdef SPI_HAS_TRANSACTION
+    SPI.endTransaction();
+#endif
+}
+
+void LedStripAdapterWS2812::transmitPin() {
+#ifdef WS2812_PIN_OUTPUT
+    // Make sure the pin is initialized
+    uint16_t i = this->ledCount * this->bytesPerPixel;
+    if(this->port == NULL || i == 0)
+        return;
+
+    // Determine the port values with the data line high and low, other pins on the port are left as they are
+    uint8_t* ptr = this->pixels;
+    uint8_t hi = *this->port | this->pinMask;
+    uint8_t lo = *this->port & ~this->pinMask;
+
+#if defined(__AVR__)
+    // Each bit takes 20 cycles at 16 MHz, 1.25 us. The line goes high at cycle 0, and low at cycle 5 for a 0 bit
+    // (0.31 us) or cycle 13 for a 1 bit (0.81 us). The port is written at the same cycles for every bit, the data bit
+    // only selects whether the second write keeps the line high.
+    volatile uint8_t* port = this->port;
+    uint8_t value = *ptr++;
+    uint8_t next = lo;
+    uint8_t bit = 8;
+
+    noInterrupts();
+    asm volatile(
+        "ws2812Head%=:"               "\n\t" // Cycle
+        "st   %a[port], %[hi]"        "\n\t" // 0     Line high
+        "sbrc %[value], 7"            "\n\t" // 2     If the bit is set
+        "mov  %[next], %[hi]"         "\n\t" // 3       keep the line high
+        "dec  %[bit]"                 "\n\t" // 4
+        "st   %a[port], %[next]"      "\n\t" // 5     Line low for a 0 bit
+        "mov  %[next], %[lo]"         "\n\t" // 7
+        "breq ws2812NextByte%="       "\n\t" // 8     Last bit of the byte
+        "rol  %[value]"               "\n\t" // 9
+        "rjmp .+0"                    "\n\t" // 10
+        "nop"                         "\n\t" // 12
+        "st   %a[port], %[lo]"        "\n\t" // 13    Line low for a 1 bit
+        "nop"                         "\n\t" // 15
+        "rjmp .+0"                    "\n\t" // 16
+        "rjmp ws2812Head%="           "\n\t" // 18
+        "ws2812NextByte%=:"           "\n\t"
+        "ldi  %[bit], 8"              "\n\t" // 10
+        "ld   %[value], %a[ptr]+"     "\n\t" // 11
+        "st   %a[port], %[lo]"        "\n\t" // 13    Line low for a 1 bit
+        "nop"                         "\n\t" // 15
+        "sbiw %[count], 1"            "\n\t" // 16
+        "brne ws2812Head%="           "\n"   // 18
+        : [port] "+e" (port),
+          [value] "+r" (value),
+          [bit] "+d" (bit),
+          [next] "+r" (next),
+          [count] "+w" (i),
+          [ptr] "+e" (ptr)
+        : [hi] "r" (hi),
+          [lo] "r" (lo));
+    interrupts();
+#else
+    // Write the same port sequence as the timed loop, so the output can be captured and checked on the host
+    LedStripPortReg* port = this->port;
+    while(i--) {
+        uint8_t value = *ptr++;
+        for(uint8_t bit = 0x80; bit; bit >>= 1) {
+            *port = hi;
+            *port = (value & bit) ? hi : lo;
+            *port = lo;
+        }
+    }
+#endif
+#endif
+}
+
+uint16_t LedStripAdapterWS2812::getLedCount() {
+    return this->ledCount;
+}
+
+void LedStripAdapterWS2812::setLedCount(uint16_t ledCount) {
+    // Reallocate the buffers, and make sure the resized strip is rendered
+    this->ledCount = ledCount;
+    this->allocate();
+    this->invalidate();
+}
+
+LedStripColor LedStripAdapterWS2812::getLedColor(uint16_t ledIndex) {
+    // Make sure the LED is on the strip
+    if(ledIndex >= this->ledCount)
+        return LedStripColor::black();
+
+    return LedStripPixelWS2812::decode(&this->pixels[ledIndex * LedStripPixelWS2812::BYTES_PER_PIXEL]);
+}
+
+void LedStripAdapterWS2812::setLedColor(uint16_t ledIndex, LedStripColor color) {
+    this->setLedColor(ledIndex, color.getRed(), color.getGreen(), color.getBlue());
+}
+
+void LedStripAdapterWS2812::setLedColor(uint16_t ledIndex, uint8_t redChannel) {
+    // Get the color of the LED
+    LedStripColor ledColor = this->getLedColor(ledIndex);
+
+    // Set the red channel
+    ledColor.setRed(redChannel);
+
+    // Update the led color
+    this->setLedColor(ledIndex, ledColor);
+}
+
+void LedStripAdapterWS2812::setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel) {
+    // Get the color of the LED
+    LedStripColor ledColor = this->getLedColor(ledIndex);
+
+    // Set the red and green channel
+    ledColor.setRed(redChannel);
+    ledColor.setGreen(greenChannel);
+
+    // Update the led color
+    this->setLedColor(ledIndex, ledColor);
+}
+
+void LedStripAdapterWS2812::setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel,
+                                        uint8_t blueChannel) {
+    // Make sure the LED is on the strip
+    if(ledIndex >= this->ledCount)
+        return;
+
+    // Write the pixel, and mark the LED as dirty if it changed
+    if(this->writePixel(&this->pixels[ledIndex * LedStripPixelWS2812::BYTES_PER_PIXEL],
+                        redChannel, greenChannel, blueChannel))
+        this->markDirty(ledIndex, ledIndex + 1, 1);
+}
+
+void LedStripAdapterWS2812::setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel,
+                                        uint8_t blueChannel, uint8_t) {
+    // The strip doesn't support an alpha channel, ignore it
+    this->setLedColor(ledIndex, redChannel, greenChannel, blueChannel);
+}
+
+uint32_t LedStripAdapterWS2812::getLedColorCombinedChannels(uint16_t ledIndex) {
+    return this->getLedColor(ledIndex).getCombinedChannels();
+}
+
+void LedStripAdapterWS2812::setLedColorCombinedChannels(uint16_t ledIndex, uint32_t combinedColorValue) {
+    // Split the combined value into its channels, and set the LEDs color
+    this->setLedColor(ledIndex,
+                      (uint8_t) (combinedColorValue >> 24),
+                      (uint8_t) (combinedColorValue >> 16),
+                      (uint8_t) (combinedColorValue >> 8));
+}
+
+void LedStripAdapterWS2812::setLedColors(uint16_t fromLedIndex, LedStripColor* colors, uint16_t count) {
+    // Clip the span to the strip once, instead of bounds checking each LED
+    if(fromLedIndex >= this->ledCount)
+        return;
+    if(count > this->ledCount - fromLedIndex)
+        count = this->ledCount - fromLedIndex;
+
+    // Write the colors straight into the pixel buffer, and keep track of the changed range
+    uint8_t* pixel = &this->pixels[fromLedIndex * LedStripPixelWS2812::BYTES_PER_PIXEL];
+    uint16_t changedFrom = count, changedTo = 0, changedCount = 0;
+    for(uint16_t i = 0; i < count; i++, pixel += LedStripPixelWS2812::BYTES_PER_PIXEL) {
+        if(this->writePixel(pixel, colors[i].getRed(), colors[i].getGreen(), colors[i].getBlue())) {
+            if(changedCount++ == 0)
+                changedFrom = i;
+            changedTo = i + 1;
+        }
+    }
+
+    // Mark the changed range as dirty
+    this->markDirty(fromLedIndex + changedFrom, fromLedIndex + changedTo, changedCount);
+}
+
+uint32_t LedStripAdapterWS2812::getTransferRate() {
+    if(this->transmitTime == 0)
+        return 0;
+    return (uint32_t) ((uint64_t) this->ledCount * this->bytesPerPixel * 1000000UL /
+                       this->transmitTime);
+}
+
+uint8_t* LedStripAdapterWS2812::getNativePixels() {
+    return this->pixels;
+}
+
+bool LedStripAdapterWS2812::getPixelFormat(LedStripPixelFormat* format) {
+    *format = LedStripPixelWS2812::getFormat();
+    return true;
+}
+
+uint8_t LedStripAdapterWS2812::getColorChannelCount() {
+    return WS2812_COLOR_CHANNEL_COUNT;
+}
+
+uint8_t LedStripAdapterWS2812::getColorValueMax() {
+    return WS2812_COLOR_VALUE_MAX;
+}
\ No newline at end of file
@@ -0,0 +1,274 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPADAPTERWS2812_H
+#define LEDSTRIPDRIVER_LEDSTRIPADAPTERWS2812_H
+
+#include "LedStripPort.h"
+#include "LedStripColor.h"
+#include "LedStripAdapterBase.h"
+#include "LedStripPixelWS2812.h"
+
+#define WS2812_COLOR_CHANNEL_COUNT 3
+#define WS2812_COLOR_VALUE_MAX 255
+
+/**
+ * Data rate of WS2812 LED strips in bits per second.
+ */
+#define WS2812_BIT_RATE 800000UL
+
+/**
+ * Time the data line must be held low to latch a frame, in microseconds.
+ * The original WS2812 latches after 50 us, newer WS2812B revisions need 280 us.
+ */
+#define WS2812_LATCH_TIME 300
+
+/**
+ * Default number of SPI bits used to encode each data bit, see LedStripAdapterWS2812::encodeSpiBits().
+ */
+#define WS2812_SPI_BITS_DEFAULT 3
+
+// The single-wire output is timed by counting CPU cycles, which is done for 16 MHz AVR boards. The host build writes the
+// same port sequence untimed, so the output can be captured. Other targets use the SPI encoded output.
+#if (defined(__AVR__) && F_CPU == 16000000L) || defined(LED_STRIP_HOST)
+ #define WS2812_PIN_OUTPUT
+#endif
+
+/**
+ * LED strip adapter for WS2812 (NeoPixel) type LED strips.
+ * The strip is either driven directly from a pin by a cycle counted loop, or through the MOSI pin of the hardware SPI
+ * bus. For SPI, each frame is first encoded into SPI bit patterns that reproduce the single-wire timing.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripAdapterWS2812 : public LedStripAdapterBase {
+private:
+    /**
+     * Data pin, when driven from a pin.
+     */
+    uint8_t pin;
+
+    /**
+     * Number of SPI bits per data bit, or 0 if the strip is driven from a pin.
+     */
+    uint8_t spiBitsPerBit;
+
+    /**
+     * Buffer of the SPI encoded frame, or NULL if the strip is driven from a pin.
+     */
+    uint8_t* encoded;
+
+#ifdef WS2812_PIN_OUTPUT
+    /**
+     * Output register of the data pin port, resolved on initialization. NULL if not resolved yet.
+     */
+    LedStripPortReg* port;
+
+    /**
+     * Bit mask of the data pin in its port.
+     */
+    uint8_t pinMask;
+#endif
+
+    /**
+     * Time the last frame ended at, in microseconds, to respect the latch time before the next frame.
+     */
+    unsigned long frameEnd;
+
+    /**
+     * Time the last frame took to transmit, in microseconds.
+     */
+    unsigned long transmitTime;
+
+    /**
+     * Allocate the pixel buffer, and the SPI encoding buffer if used, for the current LED count.
+     * All LEDs are set to black.
+     */
+    void allocate();
+
+    /**
+     * Write a color into a native pixel.
+     *
+     * @param pixel Native pixel.
+     * @param redChannel Color value of the red channel.
+     * @param greenChannel Color value of the green channel.
+     * @param blueChannel Color value of the blue channel.
+     *
+     * @return True if the pixel changed, false if it already had this color.
+     */
+    bool writePixel(uint8_t* pixel, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel);
+
+    /**
+     * Transmit the pixel buffer on the data pin.
+     * Interrupts are disabled during the transmission, so millis() and micros() lose about 30 us per LED.
+     */
+    void transmitPin();
+
+    /**
+     * Encode the pixel buffer into SPI bit patterns, and transmit them over the hardware SPI bus.
+     * The bus is claimed for this frame only, so it may be shared with other devices.
+     */
+    void transmitSpi();
+
+protected:
+    /**
+     * Number of LEDs.
+     */
+    uint16_t ledCount;
+
+    /**
+     * Number of bytes per native pixel.
+     */
+    uint8_t bytesPerPixel;
+
+    /**
+     * Native pixel buffer.
+     */
+    uint8_t* pixels;
+
+    /**
+     * Constructor, for strips sharing the WS2812 timing with a different pixel size.
+     *
+     * @param ledCount Number of LEDs.
+     * @param pin Data pin, ignored if the strip is on the SPI bus.
+     * @param spiBitsPerBit Number of SPI bits per data bit, or 0 to drive the strip from the pin.
+     * @param bytesPerPixel Number of bytes per native pixel.
+     */
+    LedStripAdapterWS2812(uint16_t ledCount, uint8_t pin, uint8_t spiBitsPerBit, uint8_t bytesPerPixel);
+
+public:
+#ifdef WS2812_PIN_OUTPUT
+    /**
+     * Constructor, for strips driven directly from a pin.
+     *
+     * @param ledCount Number of LEDs.
+     * @param pin Data pin.
+     */
+    LedStripAdapterWS2812(uint16_t ledCount, uint8_t pin);
+#endif
+
+    /**
+     * Constructor, for strips on the MOSI pin of the hardware SPI bus.
+     * The SPI clock is the number of SPI bits per data bit times WS2812_BIT_RATE.
+     *
+     * @param ledCount Number of LEDs.
+     */
+    LedStripAdapterWS2812(uint16_t ledCount);
+
+    /**
+     * Destructor.
+     */
+    ~LedStripAdapterWS2812();
+
+    /**
+     * Get the number of SPI bits used to encode each data bit.
+     *
+     * @return 3 or 4, or 0 if the strip is driven from a pin.
+     */
+    uint8_t getSpiBitsPerBit();
+
+    /**
+     * Set the number of SPI bits used to encode each data bit.
+     * Three bits need the smallest buffer, four bits allow a higher SPI clock, for cores that can't reach 2.4 MHz
+     * closely enough. Has no effect on strips driven from a pin.
+     *
+     * @param spiBitsPerBit 3 or 4.
+     *
+     * @return True on success, false if the value isn't supported or the buffer couldn't be allocated.
+     */
+    bool setSpiBitsPerBit(uint8_t spiBitsPerBit);
+
+    /**
+     * Encode native pixel data into SPI bit patterns, that reproduce the WS2812 timing when sent at spiBitsPerBit times
+     * WS2812_BIT_RATE. With three SPI bits, a 0 bit is sent as 100 and a 1 bit as 110. With four SPI bits, a 0 bit is
+     * sent as 1000 and a 1 bit as 1110.
+     * This is a pure function of its input, it doesn't touch any adapter or bus state.
+     *
+     * @param source Native pixel data.
+     * @param size Number of bytes of pixel data.
+     * @param spiBitsPerBit Number of SPI bits per data bit, 3 or 4.
+     * @param target Buffer for the encoded data, of size times spiBitsPerBit bytes.
+     *
+     * @return Number of encoded bytes written, or 0 if the number of SPI bits isn't supported.
+     */
+    static uint32_t encodeSpiBits(const uint8_t* source, uint32_t size, uint8_t spiBitsPerBit, uint8_t* target);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void init();
+
+    // Override virtual method in BaseLedStripAdapter class
+    void init(bool render);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void render();
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint16_t getLedCount();
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedCount(uint16_t ledCount);
+
+    // Override virtual method in BaseLedStripAdapter class
+    LedStripColor getLedColor(uint16_t ledIndex);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, LedStripColor color);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel, uint8_t alphaChannel);
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint32_t getLedColorCombinedChannels(uint16_t ledIndex);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColorCombinedChannels(uint16_t ledIndex, uint32_t combinedColorValue);
+
+    // Override virtual method in BaseLedStripAdapter class
+    void setLedColors(uint16_t fromLedIndex, LedStripColor* colors, uint16_t count);
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint32_t getTransferRate();
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint8_t* getNativePixels();
+
+    // Override virtual method in BaseLedStripAdapter class
+    bool getPixelFormat(LedStripPixelFormat* format);
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint8_t getColorChannelCount();
+
+    // Override virtual method in BaseLedStripAdapter class
+    uint8_t getColorValueMax();
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPADAPTERWS2812_H
\ No newline at end of file
@@ -0,0 +1,109 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripAnimation.h"
+
+LedStripAnimation::LedStripAnimation(LedStripBase* ledStrip, unsigned long wait) {
+    this->ledStrip = ledStrip;
+    this->wait = wait;
+    this->reset();
+}
+
+LedStripAnimation::~LedStripAnimation() { }
+
+bool LedStripAnimation::update() {
+    return this->update(millis());
+}
+
+bool LedStripAnimation::update(unsigned long now) {
+    // Don't do anything if the animation has finished
+    if(this->finished)
+        return false;
+
+    // Return immediately if it isn't time for the next frame yet, or if the last frame is still being transferred
+    if(this->started && now - this->lastFrameTime < this->wait)
+        return false;
+    if(!this->ledStrip->isRenderComplete())
+        return false;
+
+    // Remember the time of this frame, and of the first frame
+    if(!this->started)
+        this->startTime = now;
+    this->frameTime = now;
+
+    // Draw the frame, and mark the animation as finished if there was nothing left to draw
+    if(!this->drawFrame(this->frame)) {
+        this->finished = true;
+        return false;
+    }
+
+    // Render the LED strip in the background, so the caller can continue while the frame is transferred
+    this->ledStrip->renderAsync();
+
+    // Schedule the next frame relative to this one to prevent drifting, unless we've fallen more than a frame behind
+    // The frames skipped by falling behind are counted as dropped
+    if(this->started && now - this->lastFrameTime < this->wait * 2)
+        this->lastFrameTime += this->wait;
+    else {
+        if(this->started && this->wait > 0)
+            this->ledStrip->addDroppedFrames((now - this->lastFrameTime) / this->wait - 1);
+        this->lastFrameTime = now;
+    }
+
+    // Move to the next frame
+    this->started = true;
+    this->frame++;
+    return true;
+}
+
+void LedStripAnimation::reset() {
+    this->lastFrameTime = 0;
+    this->startTime = 0;
+    this->frameTime = 0;
+    this->frame = 0;
+    this->started = false;
+    this->finished = false;
+}
+
+bool LedStripAnimation::isFinished() {
+    return this->finished;
+}
+
+unsigned long LedStripAnimation::getElapsedTime() {
+    return this->frameTime - this->startTime;
+}
+
+uint32_t LedStripAnimation::getFrame() {
+    return this->frame;
+}
+
+unsigned long LedStripAnimation::getWait() {
+    return this->wait;
+}
+
+void LedStripAnimation::setWait(unsigned long wait) {
+    this->wait = wait;
+}
+
+LedStripBase* LedStripAnimation::getLedStrip() {
+    return this->ledStrip;
+}
\ No newline at end of file
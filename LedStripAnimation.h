@@ -0,0 +1,174 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPANIMATION_H
+#define LEDSTRIPDRIVER_LEDSTRIPANIMATION_H
+
+#include <Arduino.h>
+
+#include "LedStripBase.h"
+
+/**
+ * Non-blocking LED strip animation base class.
+ * Unlike the LedStripAnimator methods, an animation doesn't loop or delay by itself. Each call to update() draws and
+ * renders at most one frame, once the frame wait time has passed, and returns immediately. This allows multiple
+ * animations and other work to share the CPU from within loop().
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripAnimation {
+protected:
+    /**
+     * LED strip the animation is drawn on.
+     */
+    LedStripBase* ledStrip;
+
+private:
+    /**
+     * Number of milliseconds to wait between each frame.
+     */
+    unsigned long wait;
+
+    /**
+     * Time in milliseconds the last frame was scheduled at.
+     */
+    unsigned long lastFrameTime;
+
+    /**
+     * Time in milliseconds the first frame was drawn at.
+     */
+    unsigned long startTime;
+
+    /**
+     * Time in milliseconds the current frame is drawn at.
+     */
+    unsigned long frameTime;
+
+    /**
+     * Index of the next frame to draw.
+     */
+    uint32_t frame;
+
+    /**
+     * True if the first frame has been drawn.
+     */
+    bool started;
+
+    /**
+     * True if the animation has drawn its last frame.
+     */
+    bool finished;
+
+protected:
+    /**
+     * Constructor.
+     *
+     * @param ledStrip Led strip instance pointer.
+     * @param wait Number of milliseconds to wait between each frame.
+     */
+    LedStripAnimation(LedStripBase* ledStrip, unsigned long wait);
+
+    /**
+     * Draw the given frame on the LED strip, without rendering it.
+     *
+     * @param frame Index of the frame to draw.
+     *
+     * @return True if the frame was drawn, false if the animation has no frames left.
+     */
+    virtual bool drawFrame(uint32_t frame) = 0;
+
+    /**
+     * Get the number of milliseconds elapsed between the first frame and the frame being drawn.
+     * This allows animations to be based on a duration rather than a number of frames.
+     *
+     * @return Elapsed time in milliseconds.
+     */
+    unsigned long getElapsedTime();
+
+public:
+    /**
+     * Destructor.
+     */
+    virtual ~LedStripAnimation();
+
+    /**
+     * Update the animation, using millis() as current time.
+     *
+     * @return True if a frame was rendered, false if not.
+     */
+    bool update();
+
+    /**
+     * Update the animation.
+     * This draws and renders the next frame if the frame wait time has passed, and returns immediately otherwise.
+     * Frames are rendered in the background where the LED strip supports it. A frame isn't drawn until the previous
+     * one has been transferred.
+     *
+     * @param now Current time in milliseconds.
+     *
+     * @return True if a frame was rendered, false if not.
+     */
+    bool update(unsigned long now);
+
+    /**
+     * Reset the animation, to start again from the first frame on the next update.
+     */
+    virtual void reset();
+
+    /**
+     * Check whether the animation has finished.
+     *
+     * @return True if finished, false if not.
+     */
+    bool isFinished();
+
+    /**
+     * Get the index of the next frame to draw.
+     *
+     * @return Frame index.
+     */
+    uint32_t getFrame();
+
+    /**
+     * Get the number of milliseconds to wait between each frame.
+     *
+     * @return Wait time in milliseconds.
+     */
+    unsigned long getWait();
+
+    /**
+     * Set the number of milliseconds to wait between each frame.
+     *
+     * @param wait Wait time in milliseconds.
+     */
+    void setWait(unsigned long wait);
+
+    /**
+     * Get the LED strip the animation is drawn on.
+     *
+     * @return Led strip instance pointer.
+     */
+    LedStripBase* getLedStrip();
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPANIMATION_H
\ No newline at end of file
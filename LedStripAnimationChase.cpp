@@ -0,0 +1,46 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripAnimationChase.h"
+
+LedStripAnimationChase::LedStripAnimationChase(LedStripBase* ledStrip, LedStripColor color, unsigned long wait)
+        : LedStripAnimation(ledStrip, wait) {
+    this->color = color;
+}
+
+bool LedStripAnimationChase::drawFrame(uint32_t frame) {
+    // Get the number of LEDs, the last frame turns off the last LED
+    uint16_t ledCount = this->ledStrip->getLedCount();
+    if(frame > ledCount)
+        return false;
+
+    // Clear the LED strip on the first frame, and clear the previous LED on the others
+    if(frame == 0)
+        this->ledStrip->clear(false);
+    else
+        this->ledStrip->setLedColor(frame - 1, LedStripColor::black());
+
+    // Set the color of the current LED
+    if(frame < ledCount)
+        this->ledStrip->setLedColor(frame, this->color);
+    return true;
+}
\ No newline at end of file
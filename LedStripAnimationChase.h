@@ -0,0 +1,56 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPANIMATIONCHASE_H
+#define LEDSTRIPDRIVER_LEDSTRIPANIMATIONCHASE_H
+
+#include "LedStripAnimation.h"
+
+/**
+ * Non-blocking color chasing animation, which chases one dot down the LED strip.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripAnimationChase : public LedStripAnimation {
+private:
+    /**
+     * Color of the dot.
+     */
+    LedStripColor color;
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param ledStrip Led strip instance pointer.
+     * @param color Color of the dot.
+     * @param wait Number of milliseconds to wait between each frame.
+     */
+    LedStripAnimationChase(LedStripBase* ledStrip, LedStripColor color, unsigned long wait);
+
+protected:
+    // Override virtual method in LedStripAnimation class
+    bool drawFrame(uint32_t frame);
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPANIMATIONCHASE_H
\ No newline at end of file
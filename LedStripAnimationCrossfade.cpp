@@ -0,0 +1,64 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripAnimationCrossfade.h"
+
+LedStripAnimationCrossfade::LedStripAnimationCrossfade(LedStripBase* ledStrip, LedStripColor from, LedStripColor to,
+                                                       unsigned long duration)
+        : LedStripAnimationCrossfade(ledStrip, from, to, duration, 0) { }
+
+LedStripAnimationCrossfade::LedStripAnimationCrossfade(LedStripBase* ledStrip, LedStripColor from, LedStripColor to,
+                                                       unsigned long duration, unsigned long wait)
+        : LedStripAnimation(ledStrip, wait) {
+    this->from = from;
+    this->to = to;
+    this->duration = duration;
+    this->complete = false;
+}
+
+void LedStripAnimationCrossfade::reset() {
+    LedStripAnimation::reset();
+    this->complete = false;
+}
+
+bool LedStripAnimationCrossfade::drawFrame(uint32_t) {
+    // Stop once the target color has been drawn
+    if(this->complete)
+        return false;
+
+    // Draw the target color exactly once the duration has passed
+    unsigned long elapsed = this->getElapsedTime();
+    if(elapsed >= this->duration) {
+        this->ledStrip->setAllLedColors(this->to);
+        this->complete = true;
+        return true;
+    }
+
+    // Determine the blend amount in 8-bit fixed point, long durations are scaled down first to prevent an overflow
+    uint8_t amount = this->duration < 0x1000000UL ?
+                     (uint8_t) ((elapsed << 8) / this->duration) :
+                     (uint8_t) (elapsed / (this->duration >> 8));
+
+    // Set the color of each LED
+    this->ledStrip->setAllLedColors(LedStripColor::blend(this->from, this->to, amount));
+    return true;
+}
\ No newline at end of file
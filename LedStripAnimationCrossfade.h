@@ -0,0 +1,89 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPANIMATIONCROSSFADE_H
+#define LEDSTRIPDRIVER_LEDSTRIPANIMATIONCROSSFADE_H
+
+#include "LedStripAnimation.h"
+
+/**
+ * Non-blocking crossfading animation, which fades all LEDs on the strip from one color to another over a fixed
+ * duration. Colors are blended with integer fixed point math, see LedStripColor::blend().
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripAnimationCrossfade : public LedStripAnimation {
+private:
+    /**
+     * Color to fade from.
+     */
+    LedStripColor from;
+
+    /**
+     * Color to fade to.
+     */
+    LedStripColor to;
+
+    /**
+     * Duration of the fade in milliseconds.
+     */
+    unsigned long duration;
+
+    /**
+     * True if the target color has been drawn.
+     */
+    bool complete;
+
+public:
+    /**
+     * Constructor.
+     * Frames are drawn on every update.
+     *
+     * @param ledStrip Led strip instance pointer.
+     * @param from Color to fade from.
+     * @param to Color to fade to.
+     * @param duration Duration of the fade in milliseconds.
+     */
+    LedStripAnimationCrossfade(LedStripBase* ledStrip, LedStripColor from, LedStripColor to, unsigned long duration);
+
+    /**
+     * Constructor.
+     *
+     * @param ledStrip Led strip instance pointer.
+     * @param from Color to fade from.
+     * @param to Color to fade to.
+     * @param duration Duration of the fade in milliseconds.
+     * @param wait Number of milliseconds to wait between each frame.
+     */
+    LedStripAnimationCrossfade(LedStripBase* ledStrip, LedStripColor from, LedStripColor to, unsigned long duration,
+                               unsigned long wait);
+
+    // Override virtual method in LedStripAnimation class
+    void reset();
+
+protected:
+    // Override virtual method in LedStripAnimation class
+    bool drawFrame(uint32_t frame);
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPANIMATIONCROSSFADE_H
\ No newline at end of file
@@ -0,0 +1,43 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripAnimationFade.h"
+
+LedStripAnimationFade::LedStripAnimationFade(LedStripBase* ledStrip, uint8_t from, uint8_t to, LedStripColor color,
+                                             unsigned long wait) : LedStripAnimation(ledStrip, wait) {
+    this->from = from;
+    this->to = to;
+    this->color = color;
+}
+
+bool LedStripAnimationFade::drawFrame(uint32_t frame) {
+    // Stop when the target intensity is reached
+    if(frame >= (uint32_t) (this->from < this->to ? this->to - this->from : this->from - this->to))
+        return false;
+
+    // Determine the intensity for this frame
+    uint8_t intensity = this->from < this->to ? this->from + frame : this->from - frame;
+
+    // Set the color of each LED, scaled to the intensity
+    this->ledStrip->setAllLedColors(this->color.scale(intensity));
+    return true;
+}
\ No newline at end of file
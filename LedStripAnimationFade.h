@@ -0,0 +1,68 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPANIMATIONFADE_H
+#define LEDSTRIPDRIVER_LEDSTRIPANIMATIONFADE_H
+
+#include "LedStripAnimation.h"
+
+/**
+ * Non-blocking fading animation, which fades all LEDs on the strip between two intensities of a color.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripAnimationFade : public LedStripAnimation {
+private:
+    /**
+     * Intensity to fade from.
+     */
+    uint8_t from;
+
+    /**
+     * Intensity to fade to.
+     */
+    uint8_t to;
+
+    /**
+     * Color to fade.
+     */
+    LedStripColor color;
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param ledStrip Led strip instance pointer.
+     * @param from Intensity to fade from.
+     * @param to Intensity to fade to.
+     * @param color Color to fade.
+     * @param wait Number of milliseconds to wait between each frame.
+     */
+    LedStripAnimationFade(LedStripBase* ledStrip, uint8_t from, uint8_t to, LedStripColor color, unsigned long wait);
+
+protected:
+    // Override virtual method in LedStripAnimation class
+    bool drawFrame(uint32_t frame);
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPANIMATIONFADE_H
\ No newline at end of file
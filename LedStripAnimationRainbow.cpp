@@ -0,0 +1,44 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripAnimationRainbow.h"
+
+LedStripAnimationRainbow::LedStripAnimationRainbow(LedStripBase* ledStrip, bool fit, unsigned long wait)
+        : LedStripAnimation(ledStrip, wait) {
+    this->fit = fit;
+}
+
+bool LedStripAnimationRainbow::drawFrame(uint32_t frame) {
+    // Determine the wheel iteration, stop after one full wheel cycle
+    uint16_t iteration = frame * 2;
+    if(frame * 2 >= LED_STRIP_COLOR_WHEEL_SIZE)
+        return false;
+
+    // Color all the LEDs, either one wheel position apart or spreading the whole wheel over the strip
+    uint16_t ledCount = this->ledStrip->getLedCount();
+    if(this->fit && ledCount > 0)
+        this->ledStrip->setRangeLedColorsFromWheel(0, ledCount, iteration,
+                (uint32_t) LED_STRIP_COLOR_WHEEL_SIZE * LED_STRIP_COLOR_WHEEL_STEP / ledCount);
+    else
+        this->ledStrip->setRangeLedColorsFromWheel(0, ledCount, iteration, LED_STRIP_COLOR_WHEEL_STEP);
+    return true;
+}
\ No newline at end of file
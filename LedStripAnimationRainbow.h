@@ -0,0 +1,56 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPANIMATIONRAINBOW_H
+#define LEDSTRIPDRIVER_LEDSTRIPANIMATIONRAINBOW_H
+
+#include "LedStripAnimation.h"
+
+/**
+ * Non-blocking rainbow animation, which cycles a color wheel along the LED strip once.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripAnimationRainbow : public LedStripAnimation {
+private:
+    /**
+     * True to fit the whole color wheel on the LED strip, false to use one wheel position per LED.
+     */
+    bool fit;
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param ledStrip Led strip instance pointer.
+     * @param fit True to fit the whole color wheel on the LED strip, false to use one wheel position per LED.
+     * @param wait Number of milliseconds to wait between each frame.
+     */
+    LedStripAnimationRainbow(LedStripBase* ledStrip, bool fit, unsigned long wait);
+
+protected:
+    // Override virtual method in LedStripAnimation class
+    bool drawFrame(uint32_t frame);
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPANIMATIONRAINBOW_H
\ No newline at end of file
@@ -0,0 +1,68 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripAnimationTheaterChase.h"
+
+LedStripAnimationTheaterChase::LedStripAnimationTheaterChase(LedStripBase* ledStrip, LedStripColor color,
+                                                             uint16_t cycles, unsigned long wait)
+        : LedStripAnimation(ledStrip, wait) {
+    this->color = color;
+    this->rainbow = false;
+    this->cycles = cycles;
+}
+
+LedStripAnimationTheaterChase::LedStripAnimationTheaterChase(LedStripBase* ledStrip, uint16_t cycles,
+                                                             unsigned long wait)
+        : LedStripAnimation(ledStrip, wait) {
+    this->rainbow = true;
+    this->cycles = cycles;
+}
+
+bool LedStripAnimationTheaterChase::drawFrame(uint32_t frame) {
+    // Each cycle has three frames, the last frame turns off the last LEDs
+    uint32_t frameCount = (uint32_t) this->cycles * 3;
+    if(frame > frameCount)
+        return false;
+
+    // Get the number of LEDs
+    uint16_t ledCount = this->ledStrip->getLedCount();
+
+    // Turn the LEDs of the previous frame off again
+    if(frame > 0)
+        for(uint16_t ledIndex = (frame - 1) % 3; ledIndex < ledCount; ledIndex += 3)
+            this->ledStrip->setLedColor(ledIndex, LedStripColor::black());
+
+    // Turn every third LED on
+    if(frame < frameCount) {
+        uint16_t cycle = frame / 3;
+        uint8_t subLedIndex = frame % 3;
+        for(uint16_t ledIndex = 0; ledIndex + subLedIndex < ledCount; ledIndex += 3) {
+            if(this->rainbow)
+                this->ledStrip->setLedColor(ledIndex + subLedIndex, LedStripColor::fromSmallWheel(
+                        (ledIndex + cycle) % LED_STRIP_COLOR_WHEEL_SMALL_SIZE
+                ));
+            else
+                this->ledStrip->setLedColor(ledIndex + subLedIndex, this->color);
+        }
+    }
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPANIMATIONTHEATERCHASE_H
+#define LEDSTRIPDRIVER_LEDSTRIPANIMATIONTHEATERCHASE_H
+
+#include "LedStripAnimation.h"
+
+/**
+ * Non-blocking theater styled chasing animation, which lights up every third LED and moves them down the LED strip.
+ * The LEDs either have a single color, or follow a rainbow.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripAnimationTheaterChase : public LedStripAnimation {
+private:
+    /**
+     * Color of the LEDs, if no rainbow is used.
+     */
+    LedStripColor color;
+
+    /**
+     * True to color the LEDs with a rainbow, false to use the color.
+     */
+    bool rainbow;
+
+    /**
+     * Number of cycles.
+     */
+    uint16_t cycles;
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param ledStrip Led strip instance pointer.
+     * @param color Color of the LEDs.
+     * @param cycles Number of cycles.
+     * @param wait Number of milliseconds to wait between each frame.
+     */
+    LedStripAnimationTheaterChase(LedStripBase* ledStrip, LedStripColor color, uint16_t cycles, unsigned long wait);
+
+    /**
+     * Constructor, to color the LEDs with a rainbow.
+     *
+     * @param ledStrip Led strip instance pointer.
+     * @param cycles Number of cycles.
+     * @param wait Number of milliseconds to wait between each frame.
+     */
+    LedStripAnimationTheaterChase(LedStripBase* ledStrip, uint16_t cycles, unsigned long wait);
+
+protected:
+    // Override virtual method in LedStripAnimation class
+    bool drawFrame(uint32_t frame);
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPANIMATIONTHEATERCHASE_H
\ No newline at end of file
@@ -0,0 +1,38 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripAnimationWipe.h"
+
+LedStripAnimationWipe::LedStripAnimationWipe(LedStripBase* ledStrip, LedStripColor color, unsigned long wait)
+        : LedStripAnimation(ledStrip, wait) {
+    this->color = color;
+}
+
+bool LedStripAnimationWipe::drawFrame(uint32_t frame) {
+    // Stop when all LEDs are filled
+    if(frame >= this->ledStrip->getLedCount())
+        return false;
+
+    // Set the color of the current LED
+    this->ledStrip->setLedColor(frame, this->color);
+    return true;
+}
\ No newline at end of file
@@ -21,6 +21,8 @@
  ******************************************************************************/
 
 #include "LedStripAnimator.h"
+#include "LedStripAnimationCrossfade.h"
+#include "LedStripFrameScheduler.h"
 
 void LedStripAnimator::fadeIn(LedStripBase *ledStrip, LedStripColor color) {
     LedStripAnimator::fade(ledStrip, 0, 255, color);
@@ -35,51 +37,56 @@ void LedStripAnimator::fade(LedStripBase *ledStrip, uint8_t from, uint8_t to, Le
 }
 
 void LedStripAnimator::fade(LedStripBase *ledStrip, uint8_t from, uint8_t to, LedStripColor color, unsigned long wait) {
+    // Pace the frames from the start of each frame
+    LedStripFrameScheduler scheduler = LedStripFrameScheduler::fromWait(ledStrip, wait);
+
     // Define an index variable
     uint8_t i = from;
 
     // Loop through all
     while(i != to) {
-        // Determine the fading factor
-        float factor = (float) i / 256.0f;
-
-        // Set the color of each LED
-        ledStrip->setAllLedColors(
-                (uint8_t) ((float) color.getRed() * factor),
-                (uint8_t) ((float) color.getGreen() * factor),
-                (uint8_t) ((float) color.getBlue() * factor)
-        );
+        // Set the color of each LED, scaled to the current intensity
+        ledStrip->setAllLedColors(color.scale(i));
 
         // Render the LED strip
         ledStrip->render();
 
-        // Wait for the given amount of time
-        delay(wait);
+        // Wait for the rest of the frame time, the time spent rendering is compensated for
+        scheduler.waitFrame();
 
         // Iterate to the next
         i += from < to ? 1 : -1;
     }
 }
 
+void LedStripAnimator::crossfade(LedStripBase *ledStrip, LedStripColor from, LedStripColor to, unsigned long duration) {
+    // Run the crossfade animation until it's finished
+    LedStripAnimationCrossfade animation(ledStrip, from, to, duration);
+    while(!animation.isFinished())
+        animation.update();
+}
+
 void LedStripAnimator::rainbow(LedStripBase *ledStrip) {
     LedStripAnimator::rainbow(ledStrip, 0);
 }
 
 void LedStripAnimator::rainbow(LedStripBase *ledStrip, unsigned long wait) {
-    // Define the for-loop index variables
-    uint16_t ledIndex, iteration;
+    // Pace the frames from the start of each frame
+    LedStripFrameScheduler scheduler = LedStripFrameScheduler::fromWait(ledStrip, wait);
+
+    // Define the for-loop index variable
+    uint16_t iteration;
 
     // Loop through all the rainbow iterations
     for(iteration = 0; iteration < LED_STRIP_COLOR_WHEEL_SIZE; iteration += 2) {
-        // Color all the LEDs
-        for(ledIndex = 0; ledIndex < ledStrip->getLedCount(); ledIndex++)
-            ledStrip->setLedColor(ledIndex, LedStripColor::fromWheel(ledIndex + iteration));
+        // Color all the LEDs, one wheel position apart
+        ledStrip->setRangeLedColorsFromWheel(0, ledStrip->getLedCount(), iteration, LED_STRIP_COLOR_WHEEL_STEP);
 
         // Render the LED strip
         ledStrip->render();
 
-        // Wait for the given amount of time
-        delay(wait);
+        // Wait for the rest of the frame time, the time spent rendering is compensated for
+        scheduler.waitFrame();
     }
 }
 
@@ -88,26 +95,35 @@ void LedStripAnimator::rainbowFit(LedStripBase *ledStrip) {
 }
 
 void LedStripAnimator::rainbowFit(LedStripBase *ledStrip, unsigned long wait) {
-    // Define the for-loop index variables
-    uint16_t ledIndex, iteration;
+    // Pace the frames from the start of each frame
+    LedStripFrameScheduler scheduler = LedStripFrameScheduler::fromWait(ledStrip, wait);
+
+    // Define the for-loop index variable
+    uint16_t iteration;
+
+    // Determine the wheel distance between two LEDs, once
+    uint16_t ledCount = ledStrip->getLedCount();
+    if(ledCount == 0)
+        return;
+    uint32_t stride = (uint32_t) LED_STRIP_COLOR_WHEEL_SIZE * LED_STRIP_COLOR_WHEEL_STEP / ledCount;
 
     // Loop through all the rainbow iterations
     for(iteration = 0; iteration < LED_STRIP_COLOR_WHEEL_SIZE; iteration += 2) {
-        // Color all the LEDs
-        for(ledIndex = 0; ledIndex < ledStrip->getLedCount(); ledIndex++)
-            ledStrip->setLedColor(ledIndex, LedStripColor::fromWheel(
-                    (ledIndex * LED_STRIP_COLOR_WHEEL_SIZE / ledStrip->getLedCount()) + iteration
-            ));
+        // Color all the LEDs, spreading the whole wheel over the strip
+        ledStrip->setRangeLedColorsFromWheel(0, ledCount, iteration, stride);
 
         // Render the LED strip
         ledStrip->render();
 
-        // Wait for the given amount of time
-        delay(wait);
+        // Wait for the rest of the frame time, the time spent rendering is compensated for
+        scheduler.waitFrame();
     }
 }
 
 void LedStripAnimator::wipe(LedStripBase *ledStrip, LedStripColor color, unsigned long wait) {
+    // Pace the frames from the start of each frame
+    LedStripFrameScheduler scheduler = LedStripFrameScheduler::fromWait(ledStrip, wait);
+
     // Loop through all LEDs
     for(uint16_t ledIndex = 0; ledIndex < ledStrip->getLedCount(); ledIndex++) {
         // Set the color of the current LED
@@ -116,12 +132,15 @@ void LedStripAnimator::wipe(LedStripBase *ledStrip, LedStripColor color, unsigne
         // Render the LED strip
         ledStrip->render();
 
-        // Wait for the given amount of time
-        delay(wait);
+        // Wait for the rest of the frame time, the time spent rendering is compensated for
+        scheduler.waitFrame();
     }
 }
 
 void LedStripAnimator::chase(LedStripBase *ledStrip, LedStripColor color, unsigned long wait) {
+    // Pace the frames from the start of each frame
+    LedStripFrameScheduler scheduler = LedStripFrameScheduler::fromWait(ledStrip, wait);
+
     // Clear the LED strip
     ledStrip->clear(false);
 
@@ -136,8 +155,8 @@ void LedStripAnimator::chase(LedStripBase *ledStrip, LedStripColor color, unsign
         // Clear the pixel, but don't refresh to keep it on until the next iteration
         ledStrip->setLedColor(ledIndex, LedStripColor::black());
 
-        // Wait for the given amount of time
-        delay(wait);
+        // Wait for the rest of the frame time, the time spent rendering is compensated for
+        scheduler.waitFrame();
     }
 
     // Render once more to turn off the last pixel
@@ -145,6 +164,9 @@ void LedStripAnimator::chase(LedStripBase *ledStrip, LedStripColor color, unsign
 }
 
 void LedStripAnimator::theaterChase(LedStripBase *ledStrip, LedStripColor color, uint16_t cycles, unsigned long wait) {
+    // Pace the frames from the start of each frame
+    LedStripFrameScheduler scheduler = LedStripFrameScheduler::fromWait(ledStrip, wait);
+
     // Do a few cycles
     for(int cycle = 0; cycle < cycles; cycle++) {
         for(uint16_t subLedIndex = 0; subLedIndex < 3; subLedIndex++) {
@@ -155,8 +177,8 @@ void LedStripAnimator::theaterChase(LedStripBase *ledStrip, LedStripColor color,
             // Render the LED strip
             ledStrip->render();
 
-            // Wait for the given amount of time
-            delay(wait);
+            // Wait for the rest of the frame time, the time spent rendering is compensated for
+            scheduler.waitFrame();
 
             // Turn the LEDs off again
             for(int i = 0; i < ledStrip->getLedCount(); i = i + 3)
@@ -173,6 +195,9 @@ void LedStripAnimator::theaterChaseRainbow(LedStripBase *ledStrip, unsigned long
 }
 
 void LedStripAnimator::theaterChaseRainbow(LedStripBase *ledStrip, uint16_t cycles, unsigned long wait) {
+    // Pace the frames from the start of each frame
+    LedStripFrameScheduler scheduler = LedStripFrameScheduler::fromWait(ledStrip, wait);
+
     // Do a few cycles
     for(int cycle = 0; cycle < cycles; cycle++) {
         for(uint16_t subLedIndex = 0; subLedIndex < 3; subLedIndex++) {
@@ -185,8 +210,8 @@ void LedStripAnimator::theaterChaseRainbow(LedStripBase *ledStrip, uint16_t cycl
             // Render the LED strip
             ledStrip->render();
 
-            // Wait for the given amount of time
-            delay(wait);
+            // Wait for the rest of the frame time, the time spent rendering is compensated for
+            scheduler.waitFrame();
 
             // Turn the LEDs off again
             for(uint16_t i = 0; i < ledStrip->getLedCount(); i = i + 3)
@@ -69,6 +69,16 @@ public:
      */
     static void fade(LedStripBase* ledStrip, uint8_t from, uint8_t to, LedStripColor color, unsigned long wait);
 
+    /**
+     * Crossfade all LEDs from one color to another.
+     *
+     * @param ledStrip Led strip instance pointer.
+     * @param from Color to fade from.
+     * @param to Color to fade to.
+     * @param duration Duration of the fade in milliseconds.
+     */
+    static void crossfade(LedStripBase* ledStrip, LedStripColor from, LedStripColor to, unsigned long duration);
+
     /**
      * Rainbow animation.
      *
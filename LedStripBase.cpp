@@ -24,16 +24,19 @@
 
 LedStripBase::LedStripBase(uint16_t ledCount) {
     this->ledCount = ledCount;
+    this->adapter = NULL;
+    this->resetFrameStats();
 }
 
 LedStripBase::LedStripBase(uint16_t ledCount, LedStripAdapterBase* adapter) {
     this->ledCount = ledCount;
     this->adapter = adapter;
+    this->resetFrameStats();
 }
 
 LedStripBase::~LedStripBase() {
     // Explicitly delete dynamically allocated LED strip adapter
-    delete &this->adapter;
+    delete this->adapter;
 }
 
 uint16_t LedStripBase::getLedCount() {
@@ -52,6 +55,81 @@ LedStripAdapterBase* LedStripBase::getAdapter() {
     return this->adapter;
 }
 
+bool LedStripBase::isDirty() {
+    return this->adapter->isDirty();
+}
+
+uint16_t LedStripBase::getRenderedLedCount() {
+    return this->adapter->getRenderedLedCount();
+}
+
+void LedStripBase::render() {
+    // Only time renders of a changed strip, the adapter skips the others
+    bool dirty = this->adapter->isDirty();
+    unsigned long start = micros();
+    this->adapter->render();
+    if(dirty)
+        this->recordRender(micros() - start);
+}
+
+void LedStripBase::renderAsync() {
+    bool dirty = this->adapter->isDirty();
+    unsigned long start = micros();
+    this->adapter->renderAsync();
+    if(dirty)
+        this->recordRender(micros() - start);
+}
+
+bool LedStripBase::isRenderComplete() {
+    return this->adapter->isRenderComplete();
+}
+
+void LedStripBase::present() {
+    bool dirty = this->adapter->isDirty();
+    unsigned long start = micros();
+    this->adapter->present();
+    if(dirty)
+        this->recordRender(micros() - start);
+}
+
+void LedStripBase::recordRender(unsigned long renderTime) {
+    // Seed the average with the first render time, and update the extremes
+    if(this->frameStats.frameCount++ == 0) {
+        this->renderTimeAvgFixed = (uint32_t) renderTime << LED_STRIP_FRAME_STATS_AVERAGE_SHIFT;
+        this->frameStats.renderTimeMin = renderTime;
+        this->frameStats.renderTimeMax = renderTime;
+    } else {
+        if(renderTime < this->frameStats.renderTimeMin)
+            this->frameStats.renderTimeMin = renderTime;
+        if(renderTime > this->frameStats.renderTimeMax)
+            this->frameStats.renderTimeMax = renderTime;
+    }
+
+    // Update the rolling average, moving it a fraction of the way towards this render time
+    this->renderTimeAvgFixed += renderTime - (this->renderTimeAvgFixed >> LED_STRIP_FRAME_STATS_AVERAGE_SHIFT);
+    this->frameStats.renderTimeAvg = this->renderTimeAvgFixed >> LED_STRIP_FRAME_STATS_AVERAGE_SHIFT;
+}
+
+LedStripFrameStats LedStripBase::getFrameStats() {
+    // The transfer rate is only known after a background transfer completes, so it's taken from the adapter here
+    this->frameStats.transferRate = this->adapter != NULL ? this->adapter->getTransferRate() : 0;
+    return this->frameStats;
+}
+
+void LedStripBase::resetFrameStats() {
+    this->frameStats.frameCount = 0;
+    this->frameStats.droppedFrameCount = 0;
+    this->frameStats.renderTimeMin = 0;
+    this->frameStats.renderTimeAvg = 0;
+    this->frameStats.renderTimeMax = 0;
+    this->frameStats.transferRate = 0;
+    this->renderTimeAvgFixed = 0;
+}
+
+void LedStripBase::addDroppedFrames(uint32_t count) {
+    this->frameStats.droppedFrameCount += count;
+}
+
 void LedStripBase::setAdapter(LedStripAdapterBase* adapter) {
     this->adapter = adapter;
 }
@@ -94,6 +172,19 @@ void LedStripBase::setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t gr
     this->adapter->setLedColor(ledIndex, redChannel, greenChannel, blueChannel, alphaChannel);
 }
 
+void LedStripBase::setLedColors(uint16_t fromLedIndex, LedStripColor* colors, uint16_t count) {
+    this->adapter->setLedColors(fromLedIndex, colors, count);
+}
+
+void LedStripBase::setLedColorsCombinedChannels(uint16_t fromLedIndex, uint32_t* combinedColorValues, uint16_t count) {
+    this->adapter->setLedColorsCombinedChannels(fromLedIndex, combinedColorValues, count);
+}
+
+void LedStripBase::setRangeLedColorsFromWheel(uint16_t fromLedIndex, uint16_t toLedIndex, uint16_t position,
+                                              uint32_t stride) {
+    this->adapter->setRangeLedColorsFromWheel(fromLedIndex, toLedIndex, position, stride);
+}
+
 void LedStripBase::setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, LedStripColor color) {
     this->adapter->setRangeLedColors(fromLedIndex, toLedIndex, color);
 }
@@ -24,6 +24,7 @@
 #define LEDSTRIPDRIVER_LEDSTRIPBASE_H
 
 #include "LedStripAdapterBase.h"
+#include "LedStripFrameStats.h"
 
 /**
  * LedStrip base class.
@@ -38,13 +39,30 @@ private:
     /**
      * Number of LEDs this LED strip contains.
      */
-    uint8_t ledCount;
+    uint16_t ledCount;
 
     /**
      * LED strip adapter for the used LED strip type.
      */
     LedStripAdapterBase* adapter;
 
+    /**
+     * Frame timing statistics.
+     */
+    LedStripFrameStats frameStats;
+
+    /**
+     * Rolling average render time in microseconds, in fixed point with LED_STRIP_FRAME_STATS_AVERAGE_SHIFT fraction bits.
+     */
+    uint32_t renderTimeAvgFixed;
+
+    /**
+     * Record the time a render took in the frame statistics.
+     *
+     * @param renderTime Render time in microseconds.
+     */
+    void recordRender(unsigned long renderTime);
+
 protected:
     /**
      * Constructor.
@@ -62,12 +80,13 @@ protected:
      */
     LedStripBase(uint16_t ledCount, LedStripAdapterBase* adapter);
 
+public:
     /**
      * Destructor.
+     * Virtual, so LED strips that don't own their adapter, like segments, may be deleted through a base pointer.
      */
-    ~LedStripBase();
+    virtual ~LedStripBase();
 
-public:
     /**
      * Initialize the LED strip adapter.
      * Required before the LED strip is used.
@@ -76,8 +95,9 @@ public:
 
     /**
      * Render the state of the LED strip to the physical hardware.
+     * The render time is recorded in the frame statistics, see getFrameStats().
      */
-    virtual void render() = 0;
+    virtual void render();
 
     /**
      * Get the number of LEDs this LED strip has.
@@ -100,6 +120,62 @@ public:
      */
     LedStripAdapterBase* getAdapter();
 
+    /**
+     * Check whether the state of the LED strip has changed since the last render.
+     *
+     * @return True if changed, false if not.
+     */
+    bool isDirty();
+
+    /**
+     * Get the number of LED writes that changed the strip state in the last rendered frame.
+     *
+     * @return Changed LED count.
+     */
+    uint16_t getRenderedLedCount();
+
+    /**
+     * Start rendering the state of the LED strip to the physical hardware, without waiting for it to complete.
+     * This allows the next frame to be computed while the current one is transferred.
+     * LED colors must not be changed until isRenderComplete() returns true.
+     * LED strips that can't transfer in the background render synchronously.
+     */
+    void renderAsync();
+
+    /**
+     * Check whether the last render has been transferred to the physical hardware.
+     *
+     * @return True if complete, false if a background render is still in progress.
+     */
+    bool isRenderComplete();
+
+    /**
+     * Present the drawn state of the LED strip, rendering it in the background.
+     * If the LED strip is double buffered, drawing may continue immediately without tearing the presented frame.
+     * Otherwise this is the same as renderAsync().
+     */
+    void present();
+
+    /**
+     * Get the frame timing statistics of this LED strip.
+     * Only renders of a changed LED strip are recorded, rendering an unchanged strip is skipped.
+     *
+     * @return Frame statistics.
+     */
+    LedStripFrameStats getFrameStats();
+
+    /**
+     * Reset the frame timing statistics.
+     */
+    void resetFrameStats();
+
+    /**
+     * Record frames dropped because the frame rate couldn't be kept up, see LedStripFrameScheduler.
+     *
+     * @param count Number of dropped frames.
+     */
+    void addDroppedFrames(uint32_t count);
+
 protected:
     /**
      * Set the LED strip adapter instance.
@@ -180,6 +256,37 @@ public:
     void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel,
                      uint8_t alphaChannel);
 
+    /**
+     * Set the colors of a span of LEDs on the strip from a contiguous buffer of colors.
+     * LEDs beyond the end of the strip are ignored.
+     *
+     * @param fromLedIndex Index of the first LED to configure.
+     * @param colors Buffer of LED colors.
+     * @param count Number of colors in the buffer.
+     */
+    void setLedColors(uint16_t fromLedIndex, LedStripColor* colors, uint16_t count);
+
+    /**
+     * Set the colors of a span of LEDs on the strip from a contiguous buffer of combined color values.
+     * LEDs beyond the end of the strip are ignored.
+     *
+     * @param fromLedIndex Index of the first LED to configure.
+     * @param combinedColorValues Buffer of combined color values.
+     * @param count Number of values in the buffer.
+     */
+    void setLedColorsCombinedChannels(uint16_t fromLedIndex, uint32_t* combinedColorValues, uint16_t count);
+
+    /**
+     * Set the color of the LEDs in the given range on the strip from a color wheel.
+     * Each next LED is a fixed stride further along the wheel, see LedStripColor::fillWheel().
+     *
+     * @param fromLedIndex From LED index.
+     * @param toLedIndex To LED index. (excluded)
+     * @param position Color wheel position of the first LED.
+     * @param stride Color wheel distance between two LEDs, in steps. (LED_STRIP_COLOR_WHEEL_STEP for one position)
+     */
+    void setRangeLedColorsFromWheel(uint16_t fromLedIndex, uint16_t toLedIndex, uint16_t position, uint32_t stride);
+
     /**
      * Set the color of the LEDs in the given range on the strip.
      *
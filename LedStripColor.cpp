@@ -56,31 +56,62 @@ LedStripColor LedStripColor::fromSmallWheel(uint16_t position) {
 }
 
 LedStripColor LedStripColor::fromWheel(uint16_t position) {
-    // Define the color variables
-    uint8_t r = 0, g = 0, b = 0;
+    // Cap the position, positions are usually within a few wheel turns so subtracting avoids a division
+    if(position >= LED_STRIP_COLOR_WHEEL_SIZE * 4)
+        position %= LED_STRIP_COLOR_WHEEL_SIZE;
+    while(position >= LED_STRIP_COLOR_WHEEL_SIZE)
+        position -= LED_STRIP_COLOR_WHEEL_SIZE;
 
-    // Cap the position
-    position %= LED_STRIP_COLOR_WHEEL_SIZE;
+    // The high byte selects the wheel segment, the low byte is the intensity of the rising channel
+    uint8_t up = (uint8_t) position;
+    uint8_t down = LED_STRIP_COLOR_VALUE_MAX - up;
 
     // Determine the colors
-    if(position >= 0 && position < LED_STRIP_COLOR_VALUE_SIZE) {
-        // Red down, green up
-        r = LED_STRIP_COLOR_VALUE_MAX - position % LED_STRIP_COLOR_VALUE_SIZE;
-        g = position % LED_STRIP_COLOR_VALUE_SIZE;
-
-    } else if(position >= LED_STRIP_COLOR_VALUE_SIZE && position < LED_STRIP_COLOR_VALUE_SIZE * 2) {
-        // Green down, blue up
-        g = LED_STRIP_COLOR_VALUE_MAX - position % LED_STRIP_COLOR_VALUE_SIZE;
-        b = position % LED_STRIP_COLOR_VALUE_SIZE;
-
-    } else if(position >= LED_STRIP_COLOR_VALUE_SIZE * 2 && position < LED_STRIP_COLOR_VALUE_SIZE * 3) {
-        // Blue down, red up
-        b = LED_STRIP_COLOR_VALUE_MAX - position % LED_STRIP_COLOR_VALUE_SIZE;
-        r = position % LED_STRIP_COLOR_VALUE_SIZE;
+    switch(position >> 8) {
+        case 0:
+            // Red down, green up
+            return LedStripColor(down, up, 0);
+
+        case 1:
+            // Green down, blue up
+            return LedStripColor(0, down, up);
+
+        default:
+            // Blue down, red up
+            return LedStripColor(up, 0, down);
     }
+}
+
+void LedStripColor::fillWheel(LedStripColor* colors, uint16_t count, uint32_t position, uint32_t stride) {
+    // Determine the size of the wheel in steps, and cap the position and stride to it
+    const uint32_t wheelSize = (uint32_t) LED_STRIP_COLOR_WHEEL_SIZE * LED_STRIP_COLOR_WHEEL_STEP;
+    position %= wheelSize;
+    stride %= wheelSize;
+
+    // Walk the wheel, wrapping around with a subtraction instead of a division
+    for(uint16_t i = 0; i < count; i++) {
+        colors[i] = LedStripColor::fromWheel((uint16_t) (position / LED_STRIP_COLOR_WHEEL_STEP));
+        position += stride;
+        if(position >= wheelSize)
+            position -= wheelSize;
+    }
+}
 
-    // Create and return the LED strip color instance
-    return LedStripColor(r, g, b);
+LedStripColor LedStripColor::blend(LedStripColor from, LedStripColor to, uint8_t amount) {
+    return LedStripColor(
+            LedStripColor::blendChannel(from.redChannel, to.redChannel, amount),
+            LedStripColor::blendChannel(from.greenChannel, to.greenChannel, amount),
+            LedStripColor::blendChannel(from.blueChannel, to.blueChannel, amount),
+            LedStripColor::blendChannel(from.alphaChannel, to.alphaChannel, amount)
+    );
+}
+
+uint8_t LedStripColor::blendChannel(uint8_t from, uint8_t to, uint8_t amount) {
+    // Move the given fraction of the distance towards the target, 16-bit unsigned math is enough for this
+    if(to >= from)
+        return from + (uint8_t) (((uint16_t) (to - from) * amount) >> 8);
+    else
+        return from - (uint8_t) (((uint16_t) (from - to) * amount) >> 8);
 }
 
 LedStripColor LedStripColor::black() {
@@ -135,18 +166,32 @@ void LedStripColor::setAlpha(uint8_t alphaChannel) {
     this->alphaChannel = alphaChannel;
 }
 
+LedStripColor LedStripColor::scale(uint8_t scale) {
+    // Scale in 8-bit fixed point, adding one to the scale makes 255 keep the color intact
+    uint16_t factor = (uint16_t) scale + 1;
+    return LedStripColor(
+            (uint8_t) ((this->redChannel * factor) >> 8),
+            (uint8_t) ((this->greenChannel * factor) >> 8),
+            (uint8_t) ((this->blueChannel * factor) >> 8),
+            this->alphaChannel
+    );
+}
+
 uint32_t LedStripColor::getCombinedChannels() {
     // Determine the combined color channels value based on the color channels
     return ((uint32_t) (this->redChannel & 0xFF) << 24) |
            ((uint32_t) (this->greenChannel & 0xFF) << 16) |
            ((uint32_t) (this->blueChannel & 0xFF) << 8) |
-           (uint32_t) (this->blueChannel & 0xFF);
+           (uint32_t) (this->alphaChannel & 0xFF);
 }
 
 uint32_t LedStripColor::setCombinedChannels(uint32_t combined) {
     // Fetch the color channel values from the combined value
-    this->redChannel = (uint8_t) (combined & (0xFF << 24));
-    this->greenChannel = (uint8_t) (combined & (0xFF << 16));
-    this->blueChannel = (uint8_t) (combined & (0xFF << 8));
-    this->alphaChannel = (uint8_t) (combined & 0xFF);
+    this->redChannel = (uint8_t) (combined >> 24);
+    this->greenChannel = (uint8_t) (combined >> 16);
+    this->blueChannel = (uint8_t) (combined >> 8);
+    this->alphaChannel = (uint8_t) combined;
+
+    // Return the combined value
+    return combined;
 }
\ No newline at end of file
@@ -26,9 +26,10 @@
 #include <Arduino.h>
 
 #define LED_STRIP_COLOR_VALUE_SIZE 256
-#define LED_STRIP_COLOR_VALUE_MAX LED_STRIP_COLOR_VALUE_SIZE - 1
-#define LED_STRIP_COLOR_WHEEL_SIZE LED_STRIP_COLOR_VALUE_SIZE * 3
-#define LED_STRIP_COLOR_WHEEL_SMALL_SIZE LED_STRIP_COLOR_VALUE_SIZE / 2 * 3
+#define LED_STRIP_COLOR_VALUE_MAX (LED_STRIP_COLOR_VALUE_SIZE - 1)
+#define LED_STRIP_COLOR_WHEEL_SIZE (LED_STRIP_COLOR_VALUE_SIZE * 3)
+#define LED_STRIP_COLOR_WHEEL_SMALL_SIZE (LED_STRIP_COLOR_VALUE_SIZE / 2 * 3)
+#define LED_STRIP_COLOR_WHEEL_STEP 256
 
 /**
  * LED strip color class representing a color used by the LED strip driver.
@@ -58,6 +59,17 @@ private:
      */
     uint8_t alphaChannel;
 
+    /**
+     * Blend a single color channel in 8-bit fixed point.
+     *
+     * @param from Channel value to blend from.
+     * @param to Channel value to blend to.
+     * @param amount Amount of the target value, 0 for the from value up to 255 for nearly the target value.
+     *
+     * @return Blended channel value.
+     */
+    static uint8_t blendChannel(uint8_t from, uint8_t to, uint8_t amount);
+
 public:
     /**
      * Constructor.
@@ -132,6 +144,30 @@ public:
      */
     static LedStripColor fromWheel(uint16_t position);
 
+    /**
+     * Fill a buffer with colors from a color wheel, walking the wheel with a fixed stride.
+     * The position is tracked in fixed point with LED_STRIP_COLOR_WHEEL_STEP steps per wheel position, so fractional
+     * strides, such as a whole wheel fitted on a strip, cost no division per color.
+     *
+     * @param colors Buffer to fill.
+     * @param count Number of colors to fill.
+     * @param position Color wheel position of the first color, in steps. (position * LED_STRIP_COLOR_WHEEL_STEP)
+     * @param stride Color wheel distance between two colors, in steps. (LED_STRIP_COLOR_WHEEL_STEP for one position)
+     */
+    static void fillWheel(LedStripColor* colors, uint16_t count, uint32_t position, uint32_t stride);
+
+    /**
+     * Blend two colors, using integer fixed point math only.
+     * All four channels are blended.
+     *
+     * @param from Color to blend from.
+     * @param to Color to blend to.
+     * @param amount Amount of the target color, 0 for the from color up to 255 for nearly the target color.
+     *
+     * @return Blended color.
+     */
+    static LedStripColor blend(LedStripColor from, LedStripColor to, uint8_t amount);
+
     /**
      * LED strip color instance representing black.
      */
@@ -213,6 +249,16 @@ public:
      */
     void setAlpha(uint8_t alphaChannel);
 
+    /**
+     * Get a scaled copy of this color, using integer fixed point math only.
+     * The red, green and blue channels are scaled, the alpha channel is kept.
+     *
+     * @param scale Scale, 0 for black up to 255 for the unscaled color.
+     *
+     * @return Scaled color.
+     */
+    LedStripColor scale(uint8_t scale);
+
     /**
      * Get the combined color channel values.
      *
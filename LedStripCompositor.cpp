@@ -0,0 +1,201 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripCompositor.h"
+
+/**
+ * Multiply two channel values in 8-bit fixed point, with correct rounding and without a division.
+ *
+ * @param a First value.
+ * @param b Second value.
+ *
+ * @return Product, divided by 255.
+ */
+static inline uint8_t multiplyChannel(uint8_t a, uint8_t b) {
+    uint16_t product = (uint16_t) a * b + 128;
+    return (uint8_t) ((product + (product >> 8)) >> 8);
+}
+
+/**
+ * Blend a layer channel over the channel below.
+ *
+ * @param below Channel value below.
+ * @param value Channel value of the layer.
+ * @param alpha Alpha of the layer, including the layer opacity.
+ * @param blendMode Blend mode.
+ *
+ * @return Blended channel value.
+ */
+static inline uint8_t blendChannel(uint8_t below, uint8_t value, uint8_t alpha, uint8_t blendMode) {
+    // Combine the channels according to the blend mode
+    switch(blendMode) {
+        case LED_STRIP_LAYER_BLEND_ADD:
+            value = below + value > 0xFF ? 0xFF : below + value;
+            break;
+        case LED_STRIP_LAYER_BLEND_MULTIPLY:
+            value = multiplyChannel(below, value);
+            break;
+        case LED_STRIP_LAYER_BLEND_SCREEN:
+            value = 0xFF - multiplyChannel(0xFF - below, 0xFF - value);
+            break;
+        default:
+            break;
+    }
+
+    // Mix with the channel below by the alpha, the sum stays within 16 bits
+    if(alpha == 0xFF)
+        return value;
+    uint16_t mix = (uint16_t) value * alpha + (uint16_t) below * (0xFF - alpha) + 128;
+    return (uint8_t) ((mix + (mix >> 8)) >> 8);
+}
+
+LedStripCompositor::LedStripCompositor(LedStripBase* ledStrip, uint8_t layerCapacity) {
+    // Set the fields
+    this->ledStrip = ledStrip;
+    this->layerCapacity = layerCapacity;
+    this->layerCount = 0;
+    this->invalidated = true;
+
+    // Allocate the layer list
+    this->layers = new LedStripLayer*[layerCapacity];
+}
+
+LedStripCompositor::~LedStripCompositor() {
+    // Explicitly delete the dynamically allocated layer list
+    delete[] this->layers;
+}
+
+bool LedStripCompositor::addLayer(LedStripLayer* layer) {
+    // Make sure there's room for the layer
+    if(this->layerCount >= this->layerCapacity)
+        return false;
+
+    // Add the layer, and make sure it's blended
+    this->layers[this->layerCount++] = layer;
+    this->invalidated = true;
+    return true;
+}
+
+bool LedStripCompositor::removeLayer(LedStripLayer* layer) {
+    for(uint8_t i = 0; i < this->layerCount; i++) {
+        if(this->layers[i] != layer)
+            continue;
+
+        // Move the layers above down, and make sure the LEDs it covered are blended again
+        for(this->layerCount--; i < this->layerCount; i++)
+            this->layers[i] = this->layers[i + 1];
+        this->invalidated = true;
+        return true;
+    }
+
+    return false;
+}
+
+uint8_t LedStripCompositor::getLayerCount() {
+    return this->layerCount;
+}
+
+LedStripLayer* LedStripCompositor::getLayer(uint8_t layerIndex) {
+    return layerIndex < this->layerCount ? this->layers[layerIndex] : NULL;
+}
+
+void LedStripCompositor::compose() {
+    // Determine the range changed on any layer, or take all LEDs if the layer stack changed
+    uint16_t ledCount = this->ledStrip->getLedCount();
+    uint16_t fromLedIndex = this->invalidated ? 0 : ledCount;
+    uint16_t toLedIndex = this->invalidated ? ledCount : 0;
+    for(uint8_t l = 0; l < this->layerCount; l++) {
+        LedStripAdapterLayer* layer = this->layers[l]->getLayerAdapter();
+        if(!layer->isDirty())
+            continue;
+        if(layer->getDirtyFromLedIndex() < fromLedIndex)
+            fromLedIndex = layer->getDirtyFromLedIndex();
+        if(layer->getDirtyToLedIndex() > toLedIndex)
+            toLedIndex = layer->getDirtyToLedIndex();
+    }
+    if(toLedIndex > ledCount)
+        toLedIndex = ledCount;
+
+    // Blend the range chunk by chunk, bottom layer to top layer over black
+    uint8_t channels[LED_STRIP_ADAPTER_CHUNK_SIZE][3];
+    LedStripColor colors[LED_STRIP_ADAPTER_CHUNK_SIZE];
+    for(uint16_t i = fromLedIndex; i < toLedIndex; i += LED_STRIP_ADAPTER_CHUNK_SIZE) {
+        uint16_t count = toLedIndex - i < LED_STRIP_ADAPTER_CHUNK_SIZE ? toLedIndex - i : LED_STRIP_ADAPTER_CHUNK_SIZE;
+        memset(channels, 0, sizeof(channels));
+
+        for(uint8_t l = 0; l < this->layerCount; l++) {
+            // Skip invisible layers, and only blend the LEDs a layer has
+            LedStripAdapterLayer* layer = this->layers[l]->getLayerAdapter();
+            uint8_t opacity = layer->getOpacity();
+            uint8_t blendMode = layer->getBlendMode();
+            if(opacity == 0 || i >= layer->getLedCount())
+                continue;
+            uint16_t layerCount = layer->getLedCount() - i < count ? layer->getLedCount() - i : count;
+            LedStripColor* layerColors = layer->getLayerColors() + i;
+
+            for(uint16_t k = 0; k < layerCount; k++) {
+                // Skip transparent LEDs
+                uint8_t alpha = multiplyChannel(layerColors[k].getAlpha(), opacity);
+                if(alpha == 0)
+                    continue;
+
+                channels[k][0] = blendChannel(channels[k][0], layerColors[k].getRed(), alpha, blendMode);
+                channels[k][1] = blendChannel(channels[k][1], layerColors[k].getGreen(), alpha, blendMode);
+                channels[k][2] = blendChannel(channels[k][2], layerColors[k].getBlue(), alpha, blendMode);
+            }
+        }
+
+        // Write the chunk to the strip at once
+        for(uint16_t k = 0; k < count; k++)
+            colors[k] = LedStripColor(channels[k][0], channels[k][1], channels[k][2]);
+        this->ledStrip->setLedColors(i, colors, count);
+    }
+
+    // The layers are up to date
+    for(uint8_t l = 0; l < this->layerCount; l++)
+        this->layers[l]->getLayerAdapter()->markComposited();
+    this->invalidated = false;
+}
+
+void LedStripCompositor::render() {
+    this->compose();
+    this->ledStrip->render();
+}
+
+bool LedStripCompositor::renderAsync() {
+    // Don't touch the LED strip while the last frame is still being transferred, or the change may end up in it
+    if(!this->ledStrip->isRenderComplete())
+        return false;
+
+    // Compose the layers, and render them in the background
+    this->compose();
+    this->ledStrip->renderAsync();
+    return true;
+}
+
+void LedStripCompositor::invalidate() {
+    this->invalidated = true;
+}
+
+LedStripBase* LedStripCompositor::getLedStrip() {
+    return this->ledStrip;
+}
\ No newline at end of file
@@ -0,0 +1,149 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPCOMPOSITOR_H
+#define LEDSTRIPDRIVER_LEDSTRIPCOMPOSITOR_H
+
+#include "LedStripBase.h"
+#include "LedStripColor.h"
+#include "LedStripLayer.h"
+
+/**
+ * Compositor of a stack of layers onto an LED strip.
+ * Each layer is an RGBA LED strip of its own, so background effects and overlays such as notifications may be drawn
+ * independently, without repainting each other. On render, the layers are blended bottom to top over black with their
+ * blend mode, alpha channel and opacity, using integer math only, and the result is written to the strip at once.
+ * Only the range of LEDs changed on any layer since the last render is blended again.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripCompositor {
+private:
+    /**
+     * LED strip the layers are composited onto.
+     */
+    LedStripBase* ledStrip;
+
+    /**
+     * Layers, bottom to top.
+     */
+    LedStripLayer** layers;
+
+    /**
+     * Maximum number of layers.
+     */
+    uint8_t layerCapacity;
+
+    /**
+     * Number of layers.
+     */
+    uint8_t layerCount;
+
+    /**
+     * True if all LEDs must be blended again on the next render, because the layer stack changed.
+     */
+    bool invalidated;
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param ledStrip LED strip to composite the layers onto.
+     * @param layerCapacity Maximum number of layers.
+     */
+    LedStripCompositor(LedStripBase* ledStrip, uint8_t layerCapacity);
+
+    /**
+     * Destructor.
+     * The layers aren't deleted.
+     */
+    ~LedStripCompositor();
+
+    /**
+     * Add a layer on top of the current layers.
+     * The layer must outlive the compositor.
+     *
+     * @param layer Layer.
+     *
+     * @return True on success, false if the layer capacity has been reached.
+     */
+    bool addLayer(LedStripLayer* layer);
+
+    /**
+     * Remove a layer.
+     *
+     * @param layer Layer.
+     *
+     * @return True on success, false if the layer wasn't added.
+     */
+    bool removeLayer(LedStripLayer* layer);
+
+    /**
+     * Get the number of layers.
+     *
+     * @return Layer count.
+     */
+    uint8_t getLayerCount();
+
+    /**
+     * Get a layer.
+     *
+     * @param layerIndex Index of the layer, 0 for the bottom layer.
+     *
+     * @return Layer.
+     */
+    LedStripLayer* getLayer(uint8_t layerIndex);
+
+    /**
+     * Blend the changed range of the layers, and write the result to the LED strip without rendering it.
+     */
+    void compose();
+
+    /**
+     * Compose the layers, and render the LED strip.
+     */
+    void render();
+
+    /**
+     * Compose the layers, and render the LED strip in the background.
+     * Nothing is done while the previous frame is still being transferred, the changed layers are then composed on the
+     * next call instead.
+     *
+     * @return True if the layers were composed and rendered, false if the previous frame wasn't transferred yet.
+     */
+    bool renderAsync();
+
+    /**
+     * Blend all LEDs again on the next render, instead of only the changed range.
+     */
+    void invalidate();
+
+    /**
+     * Get the LED strip the layers are composited onto.
+     *
+     * @return LED strip.
+     */
+    LedStripBase* getLedStrip();
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPCOMPOSITOR_H
\ No newline at end of file
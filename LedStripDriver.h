@@ -37,7 +37,34 @@
 
 // Include all LED strip driver headers
 #include "LedStripLPD8806.h"
+#include "LedStripAPA102.h"
+#include "LedStripWS2812.h"
+#include "LedStripSK6812.h"
+#include "LedStripSimulated.h"
+#include "LedStripGroup.h"
+#include "LedStripSegment.h"
+#include "LedStripMatrix.h"
+#include "LedStripLayer.h"
+#include "LedStripCompositor.h"
+#include "LedStripStatic.h"
+#include "LedStripStaticAdapterLPD8806.h"
 #include "LedStripColor.h"
+#include "LedStripPixelFormat.h"
+#include "LedStripPixelLPD8806.h"
+#include "LedStripPixelAPA102.h"
+#include "LedStripPixelWS2812.h"
+#include "LedStripPixelSK6812.h"
+#include "LedStripFrameStats.h"
+#include "LedStripPowerBudget.h"
 #include "LedStripAnimator.h"
+#include "LedStripAnimationFade.h"
+#include "LedStripAnimationCrossfade.h"
+#include "LedStripAnimationRainbow.h"
+#include "LedStripAnimationWipe.h"
+#include "LedStripAnimationChase.h"
+#include "LedStripAnimationTheaterChase.h"
+#include "LedStripTimeline.h"
+#include "LedStripSerialReceiver.h"
+#include "LedStripFrameScheduler.h"
 
 #endif // LEDSTRIPDRIVER_LEDSTRIPDRIVER_H
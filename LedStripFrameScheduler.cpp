@@ -0,0 +1,97 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripFrameScheduler.h"
+
+LedStripFrameScheduler::LedStripFrameScheduler(LedStripBase* ledStrip, uint16_t frameRate) {
+    this->ledStrip = ledStrip;
+    this->setFrameRate(frameRate);
+    this->reset();
+}
+
+LedStripFrameScheduler LedStripFrameScheduler::fromWait(LedStripBase* ledStrip, unsigned long wait) {
+    // Create the scheduler with the frame period in microseconds
+    LedStripFrameScheduler scheduler(ledStrip, 0);
+    scheduler.setFramePeriod(wait * 1000UL);
+
+    // Start the schedule, the first frame is due now
+    scheduler.isFrameDue(micros());
+    return scheduler;
+}
+
+bool LedStripFrameScheduler::isFrameDue() {
+    return this->isFrameDue(micros());
+}
+
+bool LedStripFrameScheduler::isFrameDue(unsigned long now) {
+    // The first frame is due immediately
+    if(!this->started) {
+        this->started = true;
+        this->nextFrameTime = now + this->framePeriod;
+        return true;
+    }
+
+    // Return if the frame isn't due yet, the signed difference handles the micros() overflow
+    long late = (long) (now - this->nextFrameTime);
+    if(late < 0)
+        return false;
+
+    // Schedule the next frame relative to this one, unless a whole frame period was missed
+    if(this->framePeriod == 0 || (unsigned long) late < this->framePeriod)
+        this->nextFrameTime += this->framePeriod;
+    else {
+        this->ledStrip->addDroppedFrames(late / this->framePeriod);
+        this->nextFrameTime = now + this->framePeriod;
+    }
+    return true;
+}
+
+void LedStripFrameScheduler::waitFrame() {
+    // Sleep for most of the remaining time, and spin for the last bit to hit the frame time closely
+    if(this->started) {
+        long remaining = (long) (this->nextFrameTime - micros());
+        if(remaining > 2000)
+            delay((unsigned long) (remaining - 1000) / 1000);
+    }
+    while(!this->isFrameDue());
+}
+
+void LedStripFrameScheduler::reset() {
+    this->started = false;
+    this->nextFrameTime = 0;
+}
+
+uint16_t LedStripFrameScheduler::getFrameRate() {
+    return this->framePeriod > 0 ? (uint16_t) (1000000UL / this->framePeriod) : 0;
+}
+
+void LedStripFrameScheduler::setFrameRate(uint16_t frameRate) {
+    this->framePeriod = frameRate > 0 ? 1000000UL / frameRate : 0;
+}
+
+unsigned long LedStripFrameScheduler::getFramePeriod() {
+    return this->framePeriod;
+}
+
+void LedStripFrameScheduler::setFramePeriod(unsigned long framePeriod) {
+    this->framePeriod = framePeriod;
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPFRAMESCHEDULER_H
+#define LEDSTRIPDRIVER_LEDSTRIPFRAMESCHEDULER_H
+
+#include <Arduino.h>
+
+#include "LedStripBase.h"
+
+/**
+ * Frame rate governor for an LED strip.
+ * Frames are scheduled at a fixed period from the previous frame rather than from the end of its render, so the time
+ * spent drawing and rendering is compensated for. If a frame is more than a full period late, the skipped frames are
+ * counted as dropped in the LED strip's frame statistics, and the schedule restarts from the current time.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripFrameScheduler {
+private:
+    /**
+     * LED strip the frames are rendered on.
+     */
+    LedStripBase* ledStrip;
+
+    /**
+     * Frame period in microseconds.
+     */
+    unsigned long framePeriod;
+
+    /**
+     * Time in microseconds the next frame is due at.
+     */
+    unsigned long nextFrameTime;
+
+    /**
+     * True if the first frame has been scheduled.
+     */
+    bool started;
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param ledStrip Led strip instance pointer.
+     * @param frameRate Target number of frames per second, 0 to not limit the frame rate.
+     */
+    LedStripFrameScheduler(LedStripBase* ledStrip, uint16_t frameRate);
+
+    /**
+     * Create a scheduler for a fixed wait between frames, and start its schedule with the current time as first frame.
+     * This paces the blocking animations, which take their wait in milliseconds.
+     *
+     * @param ledStrip Led strip instance pointer.
+     * @param wait Time in milliseconds from the start of one frame to the start of the next, 0 to not wait.
+     *
+     * @return Started frame scheduler.
+     */
+    static LedStripFrameScheduler fromWait(LedStripBase* ledStrip, unsigned long wait);
+
+    /**
+     * Check whether the next frame is due, using micros() as current time.
+     *
+     * @return True if a frame should be drawn and rendered now, false if not.
+     */
+    bool isFrameDue();
+
+    /**
+     * Check whether the next frame is due, and schedule the frame after it if so.
+     * This returns immediately, and may be used from loop() along with other work.
+     *
+     * @param now Current time in microseconds.
+     *
+     * @return True if a frame should be drawn and rendered now, false if not.
+     */
+    bool isFrameDue(unsigned long now);
+
+    /**
+     * Wait until the next frame is due, and schedule the frame after it.
+     */
+    void waitFrame();
+
+    /**
+     * Restart the schedule, making the next frame due immediately.
+     */
+    void reset();
+
+    /**
+     * Get the target frame rate.
+     *
+     * @return Frames per second, rounded down, 0 if the frame rate isn't limited.
+     */
+    uint16_t getFrameRate();
+
+    /**
+     * Set the target frame rate.
+     *
+     * @param frameRate Frames per second, 0 to not limit the frame rate.
+     */
+    void setFrameRate(uint16_t frameRate);
+
+    /**
+     * Get the frame period.
+     *
+     * @return Frame period in microseconds.
+     */
+    unsigned long getFramePeriod();
+
+    /**
+     * Set the frame period, for frame rates that aren't a whole number of frames per second.
+     *
+     * @param framePeriod Frame period in microseconds, 0 to not limit the frame rate.
+     */
+    void setFramePeriod(unsigned long framePeriod);
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPFRAMESCHEDULER_H
\ No newline at end of file
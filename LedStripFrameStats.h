@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPFRAMESTATS_H
+#define LEDSTRIPDRIVER_LEDSTRIPFRAMESTATS_H
+
+#include <Arduino.h>
+
+/**
+ * Weight of each new render time in the rolling average, as a right shift. (1/16)
+ */
+#define LED_STRIP_FRAME_STATS_AVERAGE_SHIFT 4
+
+/**
+ * Frame timing statistics of an LED strip, see LedStripBase::getFrameStats().
+ * Render times are the time spent in the render methods, which for background renders is the time to start them.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+struct LedStripFrameStats {
+    /**
+     * Number of frames rendered.
+     */
+    uint32_t frameCount;
+
+    /**
+     * Number of frames dropped, because the frame rate couldn't be kept up.
+     */
+    uint32_t droppedFrameCount;
+
+    /**
+     * Shortest render time in microseconds.
+     */
+    uint32_t renderTimeMin;
+
+    /**
+     * Rolling average render time in microseconds, over roughly the last 16 frames.
+     */
+    uint32_t renderTimeAvg;
+
+    /**
+     * Longest render time in microseconds.
+     */
+    uint32_t renderTimeMax;
+
+    /**
+     * Throughput of the last completed transfer to the physical hardware in bytes per second, 0 if unknown.
+     */
+    uint32_t transferRate;
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPFRAMESTATS_H
\ No newline at end of file
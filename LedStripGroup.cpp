@@ -0,0 +1,64 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripGroup.h"
+
+LedStripGroup::LedStripGroup(uint8_t stripCapacity) : LedStripBase(0) {
+    // Configure and set the adapter
+    this->setAdapter(new LedStripAdapterGroup(stripCapacity));
+}
+
+LedStripAdapterGroup* LedStripGroup::getGroupAdapter() {
+    return (LedStripAdapterGroup*) this->getAdapter();
+}
+
+bool LedStripGroup::addStrip(LedStripBase* strip) {
+    // Add the strip, and grow the logical LED count
+    if(!this->getGroupAdapter()->addStrip(strip, NULL))
+        return false;
+    this->setLedCount(this->getGroupAdapter()->getLedCount());
+    return true;
+}
+
+bool LedStripGroup::addStrip(LedStripLPD8806* strip) {
+    // Add the strip along with its adapter for parallel rendering, and grow the logical LED count
+    if(!this->getGroupAdapter()->addStrip(strip, strip->getLPD8806Adapter()))
+        return false;
+    this->setLedCount(this->getGroupAdapter()->getLedCount());
+    return true;
+}
+
+uint8_t LedStripGroup::getStripCount() {
+    return this->getGroupAdapter()->getStripCount();
+}
+
+LedStripBase* LedStripGroup::getStrip(uint8_t stripIndex) {
+    return this->getGroupAdapter()->getStrip(stripIndex);
+}
+
+void LedStripGroup::init() {
+    this->getAdapter()->init();
+}
+
+void LedStripGroup::init(bool render) {
+    this->getAdapter()->init(render);
+}
\ No newline at end of file
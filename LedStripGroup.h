@@ -0,0 +1,98 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPGROUP_H
+#define LEDSTRIPDRIVER_LEDSTRIPGROUP_H
+
+#include "LedStripBase.h"
+#include "LedStripAdapterGroup.h"
+#include "LedStripLPD8806.h"
+
+/**
+ * Group of LED strips, controlled as one logical LED strip.
+ * The LEDs of the strips follow each other in the order the strips were added. Rendering the group renders all strips
+ * in one pass, bit-banging LPD8806 strips that are wired to the same port in parallel.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripGroup : public LedStripBase {
+public:
+    /**
+     * Constructor.
+     *
+     * @param stripCapacity Maximum number of strips in the group.
+     */
+    LedStripGroup(uint8_t stripCapacity);
+
+    /**
+     * Get the group LED strip adapter.
+     *
+     * @return Group LED strip adapter.
+     */
+    LedStripAdapterGroup* getGroupAdapter();
+
+    /**
+     * Add a strip to the end of the group.
+     * The strip isn't owned by the group, and must outlive it.
+     *
+     * @param strip LED strip.
+     *
+     * @return True if the strip was added, false if the group is full.
+     */
+    bool addStrip(LedStripBase* strip);
+
+    /**
+     * Add an LPD8806 strip to the end of the group.
+     * It is rendered in parallel with the other LPD8806 strips in the group, where their pins allow it.
+     * The strip isn't owned by the group, and must outlive it.
+     *
+     * @param strip LED strip.
+     *
+     * @return True if the strip was added, false if the group is full.
+     */
+    bool addStrip(LedStripLPD8806* strip);
+
+    /**
+     * Get the number of strips in the group.
+     *
+     * @return Strip count.
+     */
+    uint8_t getStripCount();
+
+    /**
+     * Get a strip in the group.
+     *
+     * @param stripIndex Strip index.
+     *
+     * @return LED strip, or NULL if the index is out of range.
+     */
+    LedStripBase* getStrip(uint8_t stripIndex);
+
+    // Override virtual method in BaseLedStrip class
+    void init();
+
+    // Override virtual method in BaseLedStrip class
+    void init(bool render);
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPGROUP_H
\ No newline at end of file
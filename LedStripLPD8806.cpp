@@ -31,6 +31,15 @@ LedStripLPD8806::LedStripLPD8806(uint16_t ledCount, uint8_t pinData, uint8_t pin
     this->setAdapter(new LedStripAdapterLPD8806(ledCount, pinData, pinClock));
 }
 
+LedStripLPD8806::LedStripLPD8806(uint16_t ledCount, uint32_t spiClock) : LedStripBase(ledCount) {
+    // The hardware SPI pins depend on the board
+    this->pinData = LED_STRIP_LPD8806_PIN_HARDWARE_SPI;
+    this->pinClock = LED_STRIP_LPD8806_PIN_HARDWARE_SPI;
+
+    // Configure and set the adapter
+    this->setAdapter(new LedStripAdapterLPD8806(ledCount, spiClock));
+}
+
 LedStripLPD8806::~LedStripLPD8806() { }
 
 uint8_t LedStripLPD8806::getDataPin() {
@@ -41,14 +50,54 @@ uint8_t LedStripLPD8806::getClockPin() {
     return this->pinClock;
 }
 
+LedStripAdapterLPD8806* LedStripLPD8806::getLPD8806Adapter() {
+    return (LedStripAdapterLPD8806*) this->getAdapter();
+}
+
+uint32_t LedStripLPD8806::getSpiClock() {
+    return this->getLPD8806Adapter()->getSpiClock();
+}
+
+void LedStripLPD8806::setSpiClock(uint32_t spiClock) {
+    this->getLPD8806Adapter()->setSpiClock(spiClock);
+}
+
+uint32_t LedStripLPD8806::testSpiClock(uint32_t minSpiClock, uint32_t maxSpiClock) {
+    return this->getLPD8806Adapter()->testSpiClock(minSpiClock, maxSpiClock);
+}
+
+bool LedStripLPD8806::isDoubleBuffered() {
+    return this->getLPD8806Adapter()->isDoubleBuffered();
+}
+
+bool LedStripLPD8806::setDoubleBuffered(bool doubleBuffered) {
+    return this->getLPD8806Adapter()->setDoubleBuffered(doubleBuffered);
+}
+
+bool LedStripLPD8806::setDoubleBuffered(bool doubleBuffered, bool keepContents) {
+    return this->getLPD8806Adapter()->setDoubleBuffered(doubleBuffered, keepContents);
+}
+
+LedStripPowerBudget* LedStripLPD8806::getPowerBudget() {
+    return this->getLPD8806Adapter()->getPowerBudget();
+}
+
+void LedStripLPD8806::setPowerBudget(LedStripPowerBudget* powerBudget) {
+    this->getLPD8806Adapter()->setPowerBudget(powerBudget);
+}
+
+bool LedStripLPD8806::isDithering() {
+    return this->getLPD8806Adapter()->isDithering();
+}
+
+bool LedStripLPD8806::setDithering(bool dithering) {
+    return this->getLPD8806Adapter()->setDithering(dithering);
+}
+
 void LedStripLPD8806::init() {
     this->getAdapter()->init();
 }
 
 void LedStripLPD8806::init(bool render) {
     this->getAdapter()->init(render);
-}
-
-void LedStripLPD8806::render() {
-    this->getAdapter()->render();
 }
\ No newline at end of file
@@ -29,6 +29,11 @@
 #include "LedStripLPD8806Helper.h"
 #include "SPI.h"
 
+/**
+ * Pin number reported for the data and clock pins of LED strips on the hardware SPI pins.
+ */
+#define LED_STRIP_LPD8806_PIN_HARDWARE_SPI 0xFF
+
 /**
  * LedStrip class.
  * This class represents a physical LED strip, and provides an interface to control the strip.
@@ -59,6 +64,14 @@ public:
      */
     LedStripLPD8806(uint16_t ledCount, uint8_t pinData, uint8_t pinClock);
 
+    /**
+     * Constructor, for LED strips on the hardware SPI pins.
+     *
+     * @param ledCount Number of LEDs on this LED strip.
+     * @param spiClock SPI clock in Hz.
+     */
+    LedStripLPD8806(uint16_t ledCount, uint32_t spiClock);
+
 #pragma clang diagnostic push
 #pragma ide diagnostic ignored "HidingNonVirtualFunction"
     /**
@@ -70,25 +83,110 @@ public:
     /**
      * Get the Arduino pin used for the data signal.
      *
-     * @return Data pin.
+     * @return Data pin, or LED_STRIP_LPD8806_PIN_HARDWARE_SPI.
      */
     uint8_t getDataPin();
 
     /**
      * Get the Arduino pin used for the clock signal.
      *
-     * @return Clock pin.
+     * @return Clock pin, or LED_STRIP_LPD8806_PIN_HARDWARE_SPI.
      */
     uint8_t getClockPin();
 
+    /**
+     * Get the LPD8806 LED strip adapter.
+     *
+     * @return LPD8806 LED strip adapter.
+     */
+    LedStripAdapterLPD8806* getLPD8806Adapter();
+
+    /**
+     * Get the hardware SPI clock.
+     *
+     * @return SPI clock in Hz.
+     */
+    uint32_t getSpiClock();
+
+    /**
+     * Set the hardware SPI clock, applied from the next render.
+     *
+     * @param spiClock SPI clock in Hz.
+     */
+    void setSpiClock(uint32_t spiClock);
+
+    /**
+     * Find the highest usable hardware SPI clock, with MISO looped back to MOSI.
+     * See LedStripAdapterLPD8806::testSpiClock().
+     *
+     * @param minSpiClock Clock to start the ramp at, in Hz.
+     * @param maxSpiClock Highest clock to test, in Hz.
+     *
+     * @return Highest clock in Hz at which the test pattern was intact, or 0 if it never was.
+     */
+    uint32_t testSpiClock(uint32_t minSpiClock, uint32_t maxSpiClock);
+
+    /**
+     * Check whether double buffering is enabled.
+     *
+     * @return True if enabled, false if not.
+     */
+    bool isDoubleBuffered();
+
+    /**
+     * Enable or disable double buffering, see LedStripAdapterLPD8806::setDoubleBuffered().
+     *
+     * @param doubleBuffered True to enable, false to disable.
+     *
+     * @return False if the second buffer couldn't be allocated, true otherwise.
+     */
+    bool setDoubleBuffered(bool doubleBuffered);
+
+    /**
+     * Enable or disable double buffering, see LedStripAdapterLPD8806::setDoubleBuffered(bool, bool).
+     *
+     * @param doubleBuffered True to enable, false to disable.
+     * @param keepContents True to copy the presented frame into the new drawing buffer, false to skip the copy.
+     *
+     * @return False if the second buffer couldn't be allocated, true otherwise.
+     */
+    bool setDoubleBuffered(bool doubleBuffered, bool keepContents);
+
+    /**
+     * Get the power budget the frame is limited to.
+     *
+     * @return Power budget, or NULL if the frame isn't limited.
+     */
+    LedStripPowerBudget* getPowerBudget();
+
+    /**
+     * Limit the current draw of each rendered frame, see LedStripAdapterLPD8806::setPowerBudget().
+     *
+     * @param powerBudget Power budget, or NULL to stop limiting.
+     */
+    void setPowerBudget(LedStripPowerBudget* powerBudget);
+
+    /**
+     * Check whether temporal dithering is enabled.
+     *
+     * @return True if enabled, false if not.
+     */
+    bool isDithering();
+
+    /**
+     * Enable or disable temporal dithering, see LedStripAdapterLPD8806::setDithering().
+     *
+     * @param dithering True to enable, false to disable.
+     *
+     * @return False if the dither bits couldn't be allocated, true otherwise.
+     */
+    bool setDithering(bool dithering);
+
     // Override virtual method in BaseLedStrip class
     void init();
 
     // Override virtual method in BaseLedStrip class
     void init(bool render);
-
-    // Override virtual method in BaseLedStrip class
-    void render();
 };
 
 #endif // LEDSTRIPDRIVER_LEDSTRIPLPD8806_H
@@ -78,18 +78,131 @@ a 'latch' anyway.
 
 /*****************************************************************************/
 
+// Background transfers stream the pixel buffer from the SPI transfer
+// complete interrupt, one byte per interrupt.  There's a single SPI bus,
+// so the transfer state is shared by all instances.  They must be enabled
+// with LPD8806_ASYNC_SPI_ENABLE, see LedStripLPD8806Helper.h.  The host
+// build simulates the interrupt through its SPI shim; elsewhere, or when
+// not enabled, showAsync() falls back to a blocking show().
+#if defined(LPD8806_ASYNC_SPI_ENABLE) && defined(__AVR__)
+ #define LPD8806_ASYNC_SPI
+ #define LPD8806_SPI_WRITE(b) (SPDR = (b))
+ #define LPD8806_SPI_ATTACH() SPI.attachInterrupt()
+ #define LPD8806_SPI_YIELD()
+#elif defined(LPD8806_ASYNC_SPI_ENABLE) && defined(LED_STRIP_HOST)
+ #define LPD8806_ASYNC_SPI
+ #define LPD8806_SPI_WRITE(b) SPI.transferAsync(b)
+ #define LPD8806_SPI_ATTACH() SPI.attachInterrupt(LPD8806::transferComplete)
+ #define LPD8806_SPI_YIELD()  SPI.runInterrupt() // Let the 'ISR' run
+#endif
+
+#ifdef LPD8806_ASYNC_SPI
+static LPD8806 * volatile
+  asyncStrip     = NULL; // Instance being shown, NULL when idle
+static uint8_t * volatile
+  asyncPtr       = NULL; // Next byte to issue
+static volatile uint16_t
+  asyncRemaining = 0;    // Bytes left to issue
+static volatile boolean
+  asyncScaled    = false; // Bytes come from nextFrameByte()
+
+// Called from the SPI interrupt once the prior byte is out: issue the next
+// one, or release the bus after the last one.
+void LPD8806::transferComplete(void) {
+  if(asyncRemaining) {
+    asyncRemaining--;
+    if(asyncScaled) {
+      LPD8806_SPI_WRITE(asyncStrip->nextFrameByte());
+    } else {
+      uint8_t *ptr = asyncPtr;
+      asyncPtr = ptr + 1;
+      LPD8806_SPI_WRITE(*ptr);
+    }
+  } else {
+    SPI.detachInterrupt();
+#ifdef SPI_HAS_TRANSACTION
+    SPI.endTransaction();
+#endif
+    asyncStrip->showTime = micros() - asyncStrip->showStart;
+    asyncStrip = NULL;
+  }
+}
+
+#if defined(__AVR__)
+ISR(SPI_STC_vect) {
+  LPD8806::transferComplete();
+}
+#endif
+#else
+// No background transfers, so there's never an interrupt to handle.
+void LPD8806::transferComplete(void) {
+}
+#endif // LPD8806_ASYNC_SPI
+
+// Block until the SPI bus is no longer used by a background show():
+static void waitSPI(void) {
+#ifdef LPD8806_ASYNC_SPI
+  while(asyncStrip != NULL) {
+    LPD8806_SPI_YIELD();
+  }
+#endif
+}
+
 // Constructor for use with hardware SPI (specific clock/data pins):
 LPD8806::LPD8806(uint16_t n) {
-  pixels = NULL;
-  begun  = false;
+  pixels     = NULL;
+  ownsPixels = true;
+  frontPixels = sparePixels = ditherBits = NULL;
+  scale      = 255;
+  ditherFrame = 0;
+  showStart  = showTime = 0;
+  begun      = false;
+  spiClock   = LPD8806_SPI_CLOCK_DEFAULT;
+  updateLength(n);
+  updatePins();
+}
+
+// Constructor for use with hardware SPI at a specific clock rate (Hz):
+LPD8806::LPD8806(uint16_t n, uint32_t clock) {
+  pixels     = NULL;
+  ownsPixels = true;
+  frontPixels = sparePixels = ditherBits = NULL;
+  scale      = 255;
+  ditherFrame = 0;
+  showStart  = showTime = 0;
+  begun      = false;
+  spiClock   = clock;
   updateLength(n);
   updatePins();
 }
 
 // Constructor for use with arbitrary clock/data pins:
 LPD8806::LPD8806(uint16_t n, uint8_t dpin, uint8_t cpin) {
-  pixels = NULL;
-  begun  = false;
+  pixels     = NULL;
+  ownsPixels = true;
+  frontPixels = sparePixels = ditherBits = NULL;
+  scale      = 255;
+  ditherFrame = 0;
+  showStart  = showTime = 0;
+  begun      = false;
+  spiClock   = LPD8806_SPI_CLOCK_DEFAULT;
+  updateLength(n);
+  updatePins(dpin, cpin);
+}
+
+// Constructor for use with arbitrary clock/data pins and a caller-owned,
+// typically statically sized, pixel buffer.  The buffer must hold at least
+// n * 3 + (n + 31) / 32 bytes; it is never malloc'd or freed here, so a
+// later updateLength() must not exceed the original length.
+LPD8806::LPD8806(uint16_t n, uint8_t dpin, uint8_t cpin, uint8_t *buf) {
+  pixels     = buf;
+  ownsPixels = false;
+  frontPixels = sparePixels = ditherBits = NULL;
+  scale      = 255;
+  ditherFrame = 0;
+  showStart  = showTime = 0;
+  begun      = false;
+  spiClock   = LPD8806_SPI_CLOCK_DEFAULT;
   updateLength(n);
   updatePins(dpin, cpin);
 }
@@ -100,12 +213,25 @@ LPD8806::LPD8806(uint16_t n, uint8_t dpin, uint8_t cpin) {
 // command.  If using this constructor, MUST follow up with updateLength()
 // and updatePins() to establish the strip length and output pins!
 LPD8806::LPD8806(void) {
-  numLEDs = numBytes = 0;
-  pixels  = NULL;
-  begun   = false;
+  numLEDs    = numBytes = 0;
+  pixels     = NULL;
+  ownsPixels = true;
+  frontPixels = sparePixels = ditherBits = NULL;
+  scale      = 255;
+  ditherFrame = 0;
+  showStart  = showTime = 0;
+  begun      = false;
+  spiClock   = LPD8806_SPI_CLOCK_DEFAULT;
   updatePins(); // Must assume hardware SPI until pins are set
 }
 
+// Release the pixel buffer, unless it is owned by the caller:
+LPD8806::~LPD8806(void) {
+  waitShow();
+  setDoubleBuffer(false);
+  if(ownsPixels && pixels != NULL) free(pixels);
+}
+
 // Activate hard/soft SPI as appropriate:
 void LPD8806::begin(void) {
   if(hardwareSPI == true) startSPI();
@@ -133,7 +259,7 @@ void LPD8806::updatePins(uint8_t dpin, uint8_t cpin) {
   clkport = dataport = 0;
   clkpinmask = datapinmask = 0;
 
-#if defined(__AVR_ATmega168__) || defined(__AVR_ATmega328P__) || defined (__AVR_ATmega328__) || defined(__AVR_ATmega8__) || (__AVR_ATmega1281__) || defined(__AVR_ATmega2561__) || defined(__AVR_ATmega2560__) || defined(__AVR_ATmega1280__)
+#ifdef LED_STRIP_PORT_REGISTERS
   clkport     = portOutputRegister(digitalPinToPort(cpin));
   clkpinmask  = digitalPinToBitMask(cpin);
   dataport    = portOutputRegister(digitalPinToPort(dpin));
@@ -152,37 +278,159 @@ void LPD8806::updatePins(uint8_t dpin, uint8_t cpin) {
   hardwareSPI = false;
 }
 
-#ifndef SPI_CLOCK_DIV8
-  #define SPI_CLOCK_DIV8 4
-#endif
+// Change the hardware SPI clock rate (Hz).  Takes effect with the next
+// show(), as the bus settings are applied per transaction.  Has no effect
+// on software SPI, which runs as fast as the pins can be toggled.
+void LPD8806::setClock(uint32_t clock) {
+  spiClock = clock;
+}
+
+uint32_t LPD8806::getClock(void) {
+  return spiClock;
+}
+
+// Scale the channel values sent to the strip, for example to keep its
+// current draw within the supply.  Takes effect with the next show().
+// The pixel buffer keeps the drawn colors, each byte is scaled as it is
+// sent, so scaling (255 = off) takes no extra RAM.
+void LPD8806::setScale(uint8_t s) {
+  scale = s;
+}
+
+uint8_t LPD8806::getScale(void) {
+  return scale;
+}
+
+// Temporally dither the 7-bit output with the low bit each channel lost
+// in the 8-bit to 7-bit reduction.  The bits are a caller-owned nibble
+// per pixel, the lowest nibble first: bit 0-2 for pixel bytes 0-2.  A set
+// bit rounds its channel up on every other frame, in opposite phase for
+// neighbouring pixels, so at a high frame rate the light averages out to
+// the 8-bit value.  Takes effect with the next show().
+void LPD8806::setDither(uint8_t *bits) {
+  ditherBits = bits;
+}
+
+// Set up sending the frame.  Returns false if the pixel buffer can go
+// out as drawn, or true if its bytes must be taken from nextFrameByte(),
+// which scales and/or dithers them on the fly rather than in a copy.
+boolean LPD8806::beginFrame(void) {
+  if(scale == 255 && ditherBits == NULL) return false;
+  frameSrc        = pixels;
+  frameBits       = ditherBits;
+  frameDither     = 0;
+  frameChannel    = 0;
+  framePhase      = ditherFrame++ & 1;
+  frameColorBytes = numLEDs * 3;
+  return true;
+}
+
+// Return the next byte of the frame set up by beginFrame(): one multiply
+// per pixel byte, none when only dithering.  The latch bytes at the end go
+// out as is, as they must stay zero.  This runs from the SPI interrupt for
+// background shows.
+uint8_t LPD8806::nextFrameByte(void) {
+  uint8_t v = *frameSrc++;
+  if(frameColorBytes == 0) return v;
+  frameColorBytes--;
+  if(frameChannel == 0 && frameBits != NULL) {
+    // Low bits of this pixel, on alternating frames.  The dither phase
+    // and the nibble both alternate per pixel, so both bits flip.
+    frameDither = (framePhase & 2) ? (*frameBits++ >> 4) : *frameBits;
+    if(!(framePhase & 1)) frameDither = 0;
+    framePhase ^= 3;
+  }
+  if(++frameChannel == 3) frameChannel = 0;
+  v &= 0x7F;
+  if((frameDither & 1) && v < 0x7F) v++;
+  frameDither >>= 1;
+  if(scale == 255) return v | 0x80;
+  return (uint8_t)(((v * (uint16_t)(scale + 1)) >> 8) | 0x80);
+}
 
 // Enable SPI hardware and set up protocol details:
 void LPD8806::startSPI(void) {
   SPI.begin();
+
+#ifndef SPI_HAS_TRANSACTION
+  // Cores without SPI transactions get their settings once, here, with
+  // the closest divider that doesn't exceed the requested clock
   SPI.setBitOrder(MSBFIRST);
   SPI.setDataMode(SPI_MODE0);
-
-  SPI.setClockDivider(SPI_CLOCK_DIV8);  // 2 MHz
-  // SPI bus is run at 2MHz.  Although the LPD8806 should, in theory,
-  // work up to 20MHz, the unshielded wiring from the Arduino is more
-  // susceptible to interference.  Experiment and see what you get.
-
-#if defined(__AVR_ATmega168__) || defined(__AVR_ATmega328P__) || defined (__AVR_ATmega328__) || defined(__AVR_ATmega8__) || (__AVR_ATmega1281__) || defined(__AVR_ATmega2561__) || defined(__AVR_ATmega2560__) || defined(__AVR_ATmega1280__)
+  uint32_t clock = F_CPU / 2;
+  uint8_t  div   = 0;
+  while(div < 6 && clock > spiClock) {
+    clock >>= 1;
+    div++;
+  }
+  static const uint8_t dividers[] = {
+    SPI_CLOCK_DIV2 , SPI_CLOCK_DIV4 , SPI_CLOCK_DIV8, SPI_CLOCK_DIV16,
+    SPI_CLOCK_DIV32, SPI_CLOCK_DIV64, SPI_CLOCK_DIV128 };
+  SPI.setClockDivider(dividers[div]);
+#endif
 
   // Issue initial latch/reset to strip:
+  waitSPI();
+  beginSPI();
+#if defined(__AVR__)
   SPDR = 0; // Issue initial byte
   for(uint16_t i=((numLEDs+31)/32)-1; i>0; i--) {
     while(!(SPSR & (1<<SPIF))); // Wait for prior byte out
     SPDR = 0;                   // Issue next byte
   }
+  while(!(SPSR & (1<<SPIF)));   // Wait for last byte out
 #else
   SPI.transfer(0);
   for(uint16_t i=((numLEDs+31)/32)-1; i>0; i--) {
     SPI.transfer(0);
   }
+#endif
+  endSPI();
+}
+
+// Claim the SPI bus with this strip's settings.  The bus is released
+// again after every frame, so it may be shared with other devices.
+void LPD8806::beginSPI(void) {
+#ifdef SPI_HAS_TRANSACTION
+  SPI.beginTransaction(SPISettings(spiClock, MSBFIRST, SPI_MODE0));
+#endif
+}
+
+void LPD8806::endSPI(void) {
+#ifdef SPI_HAS_TRANSACTION
+  SPI.endTransaction();
 #endif
 }
 
+// Ramp the hardware SPI clock from minClock up to maxClock, doubling each
+// step, and return the highest rate at which a test pattern read back on
+// MISO matched what was sent, or 0 if none did.  MISO must be looped back
+// to MOSI for this.  The pattern only holds bytes with the high bit clear,
+// which the LPD8806 takes as latch bytes, so the strip keeps its colors.
+// The configured clock is left unchanged.
+uint32_t LPD8806::testClock(uint32_t minClock, uint32_t maxClock) {
+  static const uint8_t pattern[] = {
+    0x55, 0x2A, 0x7F, 0x00, 0x33, 0x4C, 0x0F, 0x70, 0x01, 0x40 };
+  uint32_t saved = spiClock, passed = 0;
+
+  if(!hardwareSPI || !begun) return 0;
+
+  for(uint32_t clock=minClock; clock && clock<=maxClock; clock <<= 1) {
+    boolean ok = true;
+    spiClock = clock;
+    beginSPI();
+    for(uint8_t i=0; i<sizeof(pattern); i++) {
+      if(SPI.transfer(pattern[i]) != pattern[i]) ok = false;
+    }
+    endSPI();
+    if(!ok) break;
+    passed = clock;
+  }
+
+  spiClock = saved;
+  return passed;
+}
+
 // Enable software SPI pins and issue initial latch:
 void LPD8806::startBitbang() {
   pinMode(datapin, OUTPUT);
@@ -207,14 +455,21 @@ void LPD8806::startBitbang() {
 // Change strip length (see notes with empty constructor, above):
 void LPD8806::updateLength(uint16_t n) {
   uint8_t latchBytes = (n + 31) / 32;
-  if(pixels != NULL) free(pixels); // Free existing data (if any)
+  boolean doubleBuffered = isDoubleBuffered();
+  waitShow(); // Don't free the buffer from under a background show()
+  setDoubleBuffer(false);
+  if(ownsPixels) {
+    if(pixels != NULL) free(pixels); // Free existing data (if any)
+    pixels = (uint8_t *)malloc(n * 3 + latchBytes); // Alloc new data
+  }
   numLEDs    = n;
   n         *= 3; // 3 bytes per pixel
   numBytes   = n + latchBytes;
-  if(NULL != (pixels = (uint8_t *)malloc(numBytes))) { // Alloc new data
+  if(NULL != pixels) {
     memset( pixels   , 0x80, n);          // Init to RGB 'off' state
     memset(&pixels[n], 0   , latchBytes); // Clear latch bytes
   } else numLEDs = numBytes = 0; // else malloc failed
+  if(doubleBuffered) setDoubleBuffer(true);
   // 'begun' state does not change -- pins retain prior modes
 }
 
@@ -222,6 +477,13 @@ uint16_t LPD8806::numPixels(void) {
   return numLEDs;
 }
 
+// Raw access to the pixel buffer, 3 GRB bytes per pixel with the high bit
+// set.  Used for bulk writes that bypass the per-pixel bounds checks; the
+// caller is responsible for staying within numPixels() * 3 bytes.
+uint8_t *LPD8806::getPixels(void) {
+  return pixels;
+}
+
 // This is how data is pushed to the strip.  Unfortunately, the company
 // that makes the chip didnt release the protocol document or you need
 // to sign an NDA or something stupid like that, but we reverse engineered
@@ -229,39 +491,285 @@ uint16_t LPD8806::numPixels(void) {
 void LPD8806::show(void) {
   uint8_t  *ptr = pixels;
   uint16_t i    = numBytes;
+  boolean  scaled;
+
+  waitShow(); // A background show() must finish first
+  showStart = micros();
+  scaled    = beginFrame();
 
   // This doesn't need to distinguish among individual pixel color
   // bytes vs. latch data, etc.  Everything is laid out in one big
   // flat buffer and issued the same regardless of purpose.
   if(hardwareSPI) {
+    waitSPI(); // The bus may be busy with another strip
+    beginSPI();
+#if defined(__AVR__)
+    // Write SPDR directly, so the next byte is prepared while the prior
+    // one is shifted out.  The last byte must be out before the bus is
+    // released to other devices.
+    if(i) {
+      SPDR = scaled ? nextFrameByte() : *ptr++; // Issue initial byte
+      while(--i) {
+        uint8_t p = scaled ? nextFrameByte() : *ptr++;
+        while(!(SPSR & (1<<SPIF))); // Wait for prior byte out
+        SPDR = p;                   // Issue new byte
+      }
+      while(!(SPSR & (1<<SPIF)));   // Wait for last byte out
+    }
+#else
     while(i--) {
-#if defined(__AVR_ATmega168__) || defined(__AVR_ATmega328P__) || defined (__AVR_ATmega328__) || defined(__AVR_ATmega8__) || (__AVR_ATmega1281__) || defined(__AVR_ATmega2561__) || defined(__AVR_ATmega2560__) || defined(__AVR_ATmega1280__)
-      while(!(SPSR & (1<<SPIF))); // Wait for prior byte out
-      SPDR = *ptr++;              // Issue new byte
+      SPI.transfer(scaled ? nextFrameByte() : *ptr++);
+    }
+#endif
+    endSPI();
+  } else if(dataport != 0) {
+    // Port registers were resolved in updatePins(), once per frame is
+    // all it takes to choose the register path
+    showBitbangPort(scaled);
+  } else {
+    showBitbangDigital(scaled);
+  }
+  showTime = micros() - showStart;
+}
+
+// Start showing the buffer in the background, and return immediately.
+// The buffer must not be changed until isShowComplete() returns true, or
+// the change may end up in the frame being sent.  Software SPI can't run
+// in the background, so it (like cores without interrupt support here, or
+// builds without LPD8806_ASYNC_SPI_ENABLE) shows the buffer synchronously.
+void LPD8806::showAsync(void) {
+#ifdef LPD8806_ASYNC_SPI
+  if(hardwareSPI && numBytes > 0) {
+    waitSPI();
+    beginSPI();
+    showStart      = micros();
+    asyncScaled    = beginFrame();
+    asyncStrip     = this;
+    asyncPtr       = pixels + 1;
+    asyncRemaining = numBytes - 1;
+    LPD8806_SPI_ATTACH();
+    // Issue initial byte, ISR does the rest
+    LPD8806_SPI_WRITE(asyncScaled ? nextFrameByte() : pixels[0]);
+    return;
+  }
+#endif
+  show();
+}
+
+boolean LPD8806::isShowComplete(void) {
+#ifdef LPD8806_ASYNC_SPI
+  return asyncStrip != this;
 #else
-      SPI.transfer(*ptr++);
+  return true;
 #endif
+}
+
+// Block until a background show() of this strip has completed:
+void LPD8806::waitShow(void) {
+#ifdef LPD8806_ASYNC_SPI
+  while(asyncStrip == this) {
+    LPD8806_SPI_YIELD();
+  }
+#endif
+}
+
+// Opt into double buffering: a second buffer is allocated, and present()
+// alternates between the two, so drawing never touches the frame being
+// shown.  This costs another numBytes of RAM.  Returns false if the
+// buffer could not be allocated, in which case single buffering stays.
+boolean LPD8806::setDoubleBuffer(boolean enable) {
+  if(enable) {
+    if(sparePixels != NULL) return true;
+    if(pixels == NULL) return false;
+    sparePixels = (uint8_t *)malloc(numBytes);
+    if(sparePixels == NULL) return false;
+    memcpy(sparePixels, pixels, numBytes);
+    frontPixels = sparePixels;
+  } else if(sparePixels != NULL) {
+    waitShow();
+    // Make sure drawing continues in the original buffer
+    if(pixels == sparePixels) {
+      memcpy(frontPixels, pixels, numBytes);
+      pixels = frontPixels;
     }
-  } else {
-    uint8_t p, bit;
+    free(sparePixels);
+    frontPixels = sparePixels = NULL;
+  }
+  return true;
+}
 
-    while(i--) {
-      p = *ptr++;
-      for(bit=0x80; bit; bit >>= 1) {
-	if (dataport != 0) {
-	  if(p & bit) *dataport |=  datapinmask;
-	  else        *dataport &= ~datapinmask;
-	  *clkport |=  clkpinmask;
-	  *clkport &= ~clkpinmask;
-	} else {
-	  if (p&bit) digitalWrite(datapin, HIGH);
-	  else digitalWrite(datapin, LOW);
-	  digitalWrite(clkpin, HIGH);
-	  digitalWrite(clkpin, LOW);
-	}
+boolean LPD8806::isDoubleBuffered(void) {
+  return sparePixels != NULL;
+}
+
+// Show the drawn buffer in the background, and continue drawing in the
+// other one.  The transmitter has captured its buffer by the time the
+// pointers are swapped, and the previous frame has completed before, so
+// the swap can't race it.  The new drawing buffer starts off as a copy of
+// the presented frame, so incremental drawing keeps working.  Without
+// double buffering, this is the same as showAsync().
+void LPD8806::present(void) {
+  present(true);
+}
+
+// As above, but the copy of the presented frame costs a pass over the
+// whole buffer each frame.  Sketches that redraw every pixel of every
+// frame may skip it, the new drawing buffer then holds the frame before
+// the presented one.
+void LPD8806::present(boolean keepContents) {
+  uint8_t *drawn;
+
+  showAsync(); // Waits for the previous frame first
+  if(sparePixels == NULL) return;
+
+  drawn       = pixels;
+  pixels      = frontPixels;
+  frontPixels = drawn;
+  if(keepContents) memcpy(pixels, frontPixels, numBytes);
+}
+
+// Clock out one data bit through the port registers:
+#define LPD8806_PORT_BIT(mask)                    \
+  if(p & (mask)) *dport |=  dmask;                \
+  else           *dport &= ~dmask;                \
+  *cport |=  cmask;                               \
+  *cport &= ~cmask;
+
+// Software SPI through direct port register access.  The registers and
+// masks are copied to locals so they stay in CPU registers, and the 8 bits
+// of each byte are unrolled so there is no bit loop or per-bit branch on
+// the output method.
+void LPD8806::showBitbangPort(boolean scaled) {
+  LedStripPortReg  *dport = dataport, *cport = clkport;
+  LedStripPortMask  dmask = datapinmask, cmask = clkpinmask;
+  uint16_t         i     = numBytes;
+  uint8_t         *ptr   = pixels, p;
+
+  while(i--) {
+    p = scaled ? nextFrameByte() : *ptr++;
+    LPD8806_PORT_BIT(0x80);
+    LPD8806_PORT_BIT(0x40);
+    LPD8806_PORT_BIT(0x20);
+    LPD8806_PORT_BIT(0x10);
+    LPD8806_PORT_BIT(0x08);
+    LPD8806_PORT_BIT(0x04);
+    LPD8806_PORT_BIT(0x02);
+    LPD8806_PORT_BIT(0x01);
+  }
+}
+
+// Software SPI through digitalWrite(), for cores without port register
+// access.  Slow, but works on any pin of any board.
+void LPD8806::showBitbangDigital(boolean scaled) {
+  uint16_t  i   = numBytes;
+  uint8_t  *ptr = pixels, p, bit;
+
+  while(i--) {
+    p = scaled ? nextFrameByte() : *ptr++;
+    for(bit=0x80; bit; bit >>= 1) {
+      digitalWrite(datapin, (p & bit) ? HIGH : LOW);
+      digitalWrite(clkpin, HIGH);
+      digitalWrite(clkpin, LOW);
+    }
+  }
+}
+
+// Show several strips, bit-banging those that share their data and clock
+// port registers together in a single pass: every bit of every strip is
+// set with one port write, followed by one clock pulse on all clock pins.
+// The frame time then follows the longest strip, rather than the sum of
+// all strips.  Strips on hardware SPI, on other ports, or on cores without
+// port register access are shown one after another.  NULL entries are
+// skipped; at most LPD8806_PARALLEL_MAX strips are taken.
+void LPD8806::showParallel(LPD8806 **strips, uint8_t count) {
+  LPD8806 *batch[LPD8806_PARALLEL_MAX];
+  uint8_t  shown = 0, i, j, n;
+
+  if(count > LPD8806_PARALLEL_MAX) count = LPD8806_PARALLEL_MAX;
+
+  for(i=0; i<count; i++) {
+    if((shown & (1 << i)) || strips[i] == NULL) continue;
+    LPD8806 *s = strips[i];
+    if(s->hardwareSPI || s->dataport == 0) {
+      s->show();
+      continue;
+    }
+
+    // Gather the remaining strips on the same ports
+    for(j=i, n=0; j<count; j++) {
+      LPD8806 *t = strips[j];
+      if((shown & (1 << j)) || t == NULL || t->hardwareSPI) continue;
+      if(t->dataport != s->dataport || t->clkport != s->clkport) continue;
+      batch[n++] = t;
+      shown     |= 1 << j;
+    }
+    if(n == 1) s->show();
+    else       showBitbangParallel(batch, n);
+  }
+}
+
+// Bit-bang strips sharing their port registers in one pass.  Strips that
+// are shorter than the longest one are sent extra zero (latch) bytes,
+// which the LPD8806 ignores.
+void LPD8806::showBitbangParallel(LPD8806 **strips, uint8_t count) {
+  LedStripPortReg  *dport    = strips[0]->dataport, *cport = strips[0]->clkport;
+  LedStripPortMask  dmask[LPD8806_PARALLEL_MAX];
+  LedStripPortMask  dataMask = 0, clkMask = 0, out;
+  uint8_t         *src[LPD8806_PARALLEL_MAX];
+  uint8_t          p[LPD8806_PARALLEL_MAX], scaled = 0, bit, k;
+  uint16_t         maxBytes = 0, i;
+  unsigned long    start, elapsed;
+
+  for(k=0; k<count; k++) {
+    strips[k]->waitShow();
+    src[k]    = strips[k]->pixels;
+    if(strips[k]->beginFrame()) scaled |= 1 << k;
+    dmask[k]  = strips[k]->datapinmask;
+    dataMask |= dmask[k];
+    clkMask  |= strips[k]->clkpinmask;
+    if(strips[k]->numBytes > maxBytes) maxBytes = strips[k]->numBytes;
+  }
+
+  start = micros();
+  for(i=0; i<maxBytes; i++) {
+    for(k=0; k<count; k++) {
+      if(i >= strips[k]->numBytes)  p[k] = 0;
+      else if(scaled & (1 << k))    p[k] = strips[k]->nextFrameByte();
+      else                          p[k] = src[k][i];
+    }
+    for(bit=0x80; bit; bit >>= 1) {
+      out = *dport & ~dataMask;
+      for(k=0; k<count; k++) {
+        if(p[k] & bit) out |= dmask[k];
       }
+      *dport  = out;
+      *cport |=  clkMask;
+      *cport &= ~clkMask;
     }
   }
+
+  // All strips took the time of the longest one
+  elapsed = micros() - start;
+  for(k=0; k<count; k++) strips[k]->showTime = elapsed;
+}
+
+// Show the current buffer the given number of times, and return the
+// achieved throughput in bytes per second (0 if too fast to measure).
+// Useful to compare wiring modes and clock rates on the actual hardware.
+uint32_t LPD8806::benchmark(uint16_t frames) {
+  unsigned long start = micros();
+  for(uint16_t f=0; f<frames; f++) show();
+  unsigned long elapsed = micros() - start;
+  if(elapsed == 0) return 0;
+  return (uint32_t)((uint64_t)numBytes * frames * 1000000UL / elapsed);
+}
+
+// Return the throughput of the last completed show() in bytes per
+// second, background or not (0 if none completed or too fast to measure).
+uint32_t LPD8806::getTransferRate(void) {
+  unsigned long t = showTime;
+  if(t == 0) return 0;
+  return (uint32_t)((uint64_t)numBytes * 1000000UL / t);
 }
 
 // Convert separate R,G,B into combined 32-bit GRB color:
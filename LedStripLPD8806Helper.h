@@ -16,44 +16,113 @@
  #include <pins_arduino.h>
 #endif
 
+// Direct port register access for the bit-banged output, see LedStripPort.h.
+#include "LedStripPort.h"
+
+// Default hardware SPI clock.  The LPD8806 should work up to 20 MHz, but
+// unshielded wiring from the Arduino is more susceptible to interference.
+#define LPD8806_SPI_CLOCK_DEFAULT 2000000UL
+
+// Maximum number of strips shown together by showParallel() in one pass.
+#define LPD8806_PARALLEL_MAX 8
+
+// Background transfers for showAsync() take over the SPI transfer complete
+// interrupt, which then can't be used by anything else in the sketch.  So
+// they are opt-in: define this here or in the build flags to enable them.
+// Without it, showAsync() shows the buffer synchronously.
+// #define LPD8806_ASYNC_SPI_ENABLE
+
 class LPD8806 {
 
  public:
 
   LPD8806(uint16_t n, uint8_t dpin, uint8_t cpin); // Configurable pins
+  LPD8806(uint16_t n, uint8_t dpin, uint8_t cpin, uint8_t *buf); // Configurable pins, caller-owned buffer
   LPD8806(uint16_t n); // Use SPI hardware; specific pins only
+  LPD8806(uint16_t n, uint32_t clock); // Use SPI hardware at given clock
   LPD8806(void); // Empty constructor; init pins & strip length later
+  ~LPD8806(void);
   void
     begin(void),
     show(void),
+    showAsync(void), // Stream buffer in background, where supported
+    waitShow(void),  // Wait for a background show() to complete
+    present(void),   // Swap buffers and show the drawn one in background
+    present(boolean keepContents), // Same, optionally skipping the copy
     setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b),
     setPixelColor(uint16_t n, uint32_t c),
     updatePins(uint8_t dpin, uint8_t cpin), // Change pins, configurable
     updatePins(void),                       // Change pins, hardware SPI
-    updateLength(uint16_t n);               // Change strip length
+    updateLength(uint16_t n),               // Change strip length
+    setClock(uint32_t clock),               // Change hardware SPI clock (Hz)
+    setScale(uint8_t scale),                // Scale output, 255 = unscaled
+    setDither(uint8_t *bits);               // Dither low bits, NULL = off
+  uint8_t
+    getScale(void);
   uint16_t
     numPixels(void);
+  uint8_t
+    *getPixels(void); // Direct access to the GRB pixel buffer
+  boolean
+    isShowComplete(void), // False while a background show() is running
+    setDoubleBuffer(boolean enable), // Opt into a second pixel buffer
+    isDoubleBuffered(void);
+  static void
+    showParallel(LPD8806 **strips, uint8_t count), // Show strips together
+    transferComplete(void); // Background show() SPI interrupt handler
   uint32_t
     Color(byte, byte, byte),
-    getPixelColor(uint16_t n);
+    getPixelColor(uint16_t n),
+    getClock(void),
+    benchmark(uint16_t frames), // Measure show() throughput in bytes/sec
+    getTransferRate(void),      // Bytes/sec of the last completed show()
+    testClock(uint32_t minClock, uint32_t maxClock); // Loopback clock ramp
 
  private:
 
   uint16_t
     numLEDs,    // Number of RGB LEDs in strip
-    numBytes;   // Size of 'pixels' buffer below
+    numBytes,   // Size of 'pixels' buffer below
+    frameColorBytes; // Pixel bytes left in the frame being sent
+  uint32_t
+    spiClock;   // Hardware SPI clock in Hz
+  volatile unsigned long
+    showStart,  // micros() the last show() started at
+    showTime;   // Duration of the last completed show() in micros
   uint8_t
-    *pixels,    // Holds LED color values (3 bytes each) + latch
-    clkpin    , datapin,     // Clock & data pin numbers
+    *pixels,      // Holds LED color values (3 bytes each) + latch
+    *frontPixels, // Buffer last presented, NULL if single buffered
+    *sparePixels, // Second buffer allocated for double buffering
+    *ditherBits,  // Dropped low bit of each channel, NULL = no dither
+    scale,        // Output scale applied to the frame, 255 = unscaled
+    ditherFrame,  // Frame counter driving the dither pattern
+    *frameSrc,    // Next byte of the frame being scaled/dithered
+    *frameBits,   // Next dither nibble of the frame being sent
+    frameDither,  // Dither bits left for the current pixel
+    frameChannel, // Byte of the current pixel, 0-2
+    framePhase,   // Bit 0: dither this pixel, bit 1: high nibble
+    clkpin    , datapin;     // Clock & data pin numbers
+  LedStripPortMask
     clkpinmask, datapinmask; // Clock & data PORT bitmasks
-  volatile uint8_t
+  LedStripPortReg
     *clkport  , *dataport;   // Clock & data PORT registers
+  boolean
+    beginFrame(void);    // True if the frame goes out scaled/dithered
+  uint8_t
+    nextFrameByte(void); // Next scaled/dithered byte of the frame
   void
     startBitbang(void),
-    startSPI(void);
+    startSPI(void),
+    beginSPI(void),
+    endSPI(void),
+    showBitbangPort(boolean scaled),
+    showBitbangDigital(boolean scaled);
+  static void
+    showBitbangParallel(LPD8806 **strips, uint8_t count);
   boolean
     hardwareSPI, // If 'true', using hardware SPI
-    begun;       // If 'true', begin() method was previously invoked
+    begun,       // If 'true', begin() method was previously invoked
+    ownsPixels;  // If 'true', 'pixels' was malloc'd by this instance
 };
 
 #endif // LIB_LPD8806_H
\ No newline at end of file
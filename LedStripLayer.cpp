@@ -0,0 +1,56 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripLayer.h"
+
+LedStripLayer::LedStripLayer(uint16_t ledCount, uint8_t blendMode) : LedStripBase(ledCount) {
+    // Configure and set the adapter
+    this->setAdapter(new LedStripAdapterLayer(ledCount, blendMode));
+}
+
+LedStripAdapterLayer* LedStripLayer::getLayerAdapter() {
+    return (LedStripAdapterLayer*) this->getAdapter();
+}
+
+uint8_t LedStripLayer::getBlendMode() {
+    return this->getLayerAdapter()->getBlendMode();
+}
+
+void LedStripLayer::setBlendMode(uint8_t blendMode) {
+    this->getLayerAdapter()->setBlendMode(blendMode);
+}
+
+uint8_t LedStripLayer::getOpacity() {
+    return this->getLayerAdapter()->getOpacity();
+}
+
+void LedStripLayer::setOpacity(uint8_t opacity) {
+    this->getLayerAdapter()->setOpacity(opacity);
+}
+
+void LedStripLayer::init() {
+    this->getAdapter()->init();
+}
+
+void LedStripLayer::init(bool render) {
+    this->getAdapter()->init(render);
+}
\ No newline at end of file
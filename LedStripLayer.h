@@ -0,0 +1,92 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPLAYER_H
+#define LEDSTRIPDRIVER_LEDSTRIPLAYER_H
+
+#include "LedStripBase.h"
+#include "LedStripAdapterLayer.h"
+
+/**
+ * Compositor layer, controlled as an LED strip of its own.
+ * Effects draw on a layer as on any other LED strip, and LedStripCompositor blends the layers onto the physical strip.
+ * LEDs are transparent until set, colors set without an alpha channel are opaque. Note that clear() makes a layer
+ * opaque black, use setAllLedColors(0, 0, 0, 0) to make it transparent again.
+ * Rendering a layer does nothing, render the compositor instead.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripLayer : public LedStripBase {
+public:
+    /**
+     * Constructor.
+     *
+     * @param ledCount Number of LEDs on this layer, usually the same as the composited strip.
+     * @param blendMode Blend mode, see LED_STRIP_LAYER_BLEND_NORMAL.
+     */
+    LedStripLayer(uint16_t ledCount, uint8_t blendMode);
+
+    /**
+     * Get the layer LED strip adapter, which holds the layer colors.
+     *
+     * @return Layer LED strip adapter.
+     */
+    LedStripAdapterLayer* getLayerAdapter();
+
+    /**
+     * Get the blend mode.
+     *
+     * @return Blend mode.
+     */
+    uint8_t getBlendMode();
+
+    /**
+     * Set the blend mode.
+     *
+     * @param blendMode Blend mode, see LED_STRIP_LAYER_BLEND_NORMAL.
+     */
+    void setBlendMode(uint8_t blendMode);
+
+    /**
+     * Get the opacity of the whole layer.
+     *
+     * @return Opacity, 0 for invisible up to 255 for the alpha channel of each LED only.
+     */
+    uint8_t getOpacity();
+
+    /**
+     * Set the opacity of the whole layer.
+     * This allows fading a layer, such as a notification, in and out without redrawing it.
+     *
+     * @param opacity Opacity, 0 for invisible up to 255 for the alpha channel of each LED only.
+     */
+    void setOpacity(uint8_t opacity);
+
+    // Override virtual method in BaseLedStrip class
+    void init();
+
+    // Override virtual method in BaseLedStrip class
+    void init(bool render);
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPLAYER_H
\ No newline at end of file
@@ -0,0 +1,253 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripMatrix.h"
+
+LedStripMatrix::LedStripMatrix(LedStripBase* ledStrip, uint16_t panelWidth, uint16_t panelHeight, uint8_t layout,
+                               uint8_t rotation) {
+    // Set the fields, a quarter turn swaps the width and height
+    this->ledStrip = ledStrip;
+    bool swap = rotation == LED_STRIP_MATRIX_ROTATE_90 || rotation == LED_STRIP_MATRIX_ROTATE_270;
+    this->width = swap ? panelHeight : panelWidth;
+    this->height = swap ? panelWidth : panelHeight;
+    this->progmemTable = false;
+    this->ownsTable = true;
+
+    // Compute the mapping table
+    uint16_t* table = (uint16_t*) malloc(sizeof(uint16_t) * this->width * this->height);
+    if(table == NULL) {
+        this->width = this->height = 0;
+    } else {
+        for(uint16_t y = 0; y < this->height; y++)
+            for(uint16_t x = 0; x < this->width; x++)
+                table[(uint32_t) y * this->width + x] = mapLedIndex(panelWidth, panelHeight, layout, rotation, x, y);
+    }
+    this->table = table;
+}
+
+LedStripMatrix::LedStripMatrix(LedStripBase* ledStrip, uint16_t width, uint16_t height, const uint16_t* progmemTable) {
+    // Set the fields
+    this->ledStrip = ledStrip;
+    this->width = width;
+    this->height = height;
+    this->table = progmemTable;
+    this->progmemTable = true;
+    this->ownsTable = false;
+}
+
+LedStripMatrix::~LedStripMatrix() {
+    // Free the table if it was computed by this instance
+    if(this->ownsTable)
+        free((void*) this->table);
+}
+
+uint16_t LedStripMatrix::mapLedIndex(uint16_t panelWidth, uint16_t panelHeight, uint8_t layout, uint8_t rotation,
+                                     uint16_t x, uint16_t y) {
+    // Undo the rotation, to get the coordinate on the panel
+    uint16_t panelX, panelY;
+    switch(rotation) {
+        case LED_STRIP_MATRIX_ROTATE_90:
+            panelX = panelWidth - 1 - y;
+            panelY = x;
+            break;
+        case LED_STRIP_MATRIX_ROTATE_180:
+            panelX = panelWidth - 1 - x;
+            panelY = panelHeight - 1 - y;
+            break;
+        case LED_STRIP_MATRIX_ROTATE_270:
+            panelX = y;
+            panelY = panelHeight - 1 - x;
+            break;
+        default:
+            panelX = x;
+            panelY = y;
+    }
+
+    // Follow the wiring of the panel
+    switch(layout) {
+        case LED_STRIP_MATRIX_ROW_SERPENTINE:
+            return panelY * panelWidth + ((panelY & 1) ? panelWidth - 1 - panelX : panelX);
+        case LED_STRIP_MATRIX_COLUMN_MAJOR:
+            return panelX * panelHeight + panelY;
+        case LED_STRIP_MATRIX_COLUMN_SERPENTINE:
+            return panelX * panelHeight + ((panelX & 1) ? panelHeight - 1 - panelY : panelY);
+        default:
+            return panelY * panelWidth + panelX;
+    }
+}
+
+uint16_t LedStripMatrix::findRun(uint16_t x, uint16_t y, bool alongRow, uint16_t maxCount, bool* descending) {
+    // Determine the direction of the run from its first two LEDs
+    uint16_t first = this->lookup(x, y);
+    *descending = false;
+    if(maxCount < 2)
+        return 1;
+    uint16_t second = alongRow ? this->lookup(x + 1, y) : this->lookup(x, y + 1);
+    if(second == first + 1)
+        *descending = false;
+    else if(second + 1 == first)
+        *descending = true;
+    else
+        return 1;
+
+    // Extend the run while the LED indices stay consecutive
+    uint16_t count = 2;
+    uint16_t expected = *descending ? second - 1 : second + 1;
+    while(count < maxCount) {
+        uint16_t next = alongRow ? this->lookup(x + count, y) : this->lookup(x, y + count);
+        if(next != expected)
+            break;
+        expected = *descending ? expected - 1 : expected + 1;
+        count++;
+    }
+    return count;
+}
+
+bool LedStripMatrix::clipRect(uint16_t* x, uint16_t* y, uint16_t* width, uint16_t* height) {
+    // Make sure the rectangle starts on the matrix
+    if(*x >= this->width || *y >= this->height)
+        return false;
+
+    // Clip the size
+    if(*width > this->width - *x)
+        *width = this->width - *x;
+    if(*height > this->height - *y)
+        *height = this->height - *y;
+    return *width > 0 && *height > 0;
+}
+
+bool LedStripMatrix::prefersRows() {
+    // Compare the run lengths from the origin along both axes
+    bool descending;
+    if(this->width == 0 || this->height == 0)
+        return true;
+    return this->findRun(0, 0, true, this->width, &descending) >= this->findRun(0, 0, false, this->height, &descending);
+}
+
+LedStripBase* LedStripMatrix::getLedStrip() {
+    return this->ledStrip;
+}
+
+uint16_t LedStripMatrix::getWidth() {
+    return this->width;
+}
+
+uint16_t LedStripMatrix::getHeight() {
+    return this->height;
+}
+
+uint16_t LedStripMatrix::getLedIndex(uint16_t x, uint16_t y) {
+    // Make sure the coordinate is on the matrix
+    if(x >= this->width || y >= this->height)
+        return this->ledStrip->getLedCount();
+
+    return this->lookup(x, y);
+}
+
+LedStripColor LedStripMatrix::getPixel(uint16_t x, uint16_t y) {
+    // Make sure the coordinate is on the matrix
+    if(x >= this->width || y >= this->height)
+        return LedStripColor::black();
+
+    return this->ledStrip->getLedColor(this->lookup(x, y));
+}
+
+void LedStripMatrix::setPixel(uint16_t x, uint16_t y, LedStripColor color) {
+    if(x < this->width && y < this->height)
+        this->ledStrip->setLedColor(this->lookup(x, y), color);
+}
+
+void LedStripMatrix::fillRow(uint16_t x, uint16_t y, uint16_t count, LedStripColor color) {
+    this->fillRect(x, y, count, 1, color);
+}
+
+void LedStripMatrix::fillColumn(uint16_t x, uint16_t y, uint16_t count, LedStripColor color) {
+    this->fillRect(x, y, 1, count, color);
+}
+
+void LedStripMatrix::fillRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height, LedStripColor color) {
+    // Clip the rectangle to the matrix
+    if(!this->clipRect(&x, &y, &width, &height))
+        return;
+
+    // Walk the rectangle along the axis with the longest runs, and fill each run as a range
+    bool alongRow = height == 1 || (width > 1 && this->prefersRows());
+    uint16_t lineCount = alongRow ? height : width;
+    uint16_t lineLength = alongRow ? width : height;
+    bool descending;
+    for(uint16_t line = 0; line < lineCount; line++) {
+        for(uint16_t i = 0; i < lineLength;) {
+            uint16_t runX = alongRow ? x + i : x + line;
+            uint16_t runY = alongRow ? y + line : y + i;
+            uint16_t run = this->findRun(runX, runY, alongRow, lineLength - i, &descending);
+            uint16_t first = this->lookup(runX, runY);
+            uint16_t lowest = descending ? first - (run - 1) : first;
+            this->ledStrip->setRangeLedColors(lowest, lowest + run, color);
+            i += run;
+        }
+    }
+}
+
+void LedStripMatrix::fill(LedStripColor color) {
+    this->fillRect(0, 0, this->width, this->height, color);
+}
+
+void LedStripMatrix::blit(uint16_t x, uint16_t y, uint16_t width, uint16_t height, LedStripColor* colors) {
+    // Clip the image to the matrix, the image stride stays the same
+    uint16_t stride = width;
+    if(!this->clipRect(&x, &y, &width, &height))
+        return;
+
+    // Walk the image along the axis with the longest runs
+    bool alongRow = height == 1 || (width > 1 && this->prefersRows());
+    uint16_t lineCount = alongRow ? height : width;
+    uint16_t lineLength = alongRow ? width : height;
+    uint16_t step = alongRow ? 1 : stride;
+    LedStripColor chunk[LED_STRIP_ADAPTER_CHUNK_SIZE];
+    bool descending;
+    for(uint16_t line = 0; line < lineCount; line++) {
+        for(uint16_t i = 0; i < lineLength;) {
+            uint16_t imageX = alongRow ? i : line;
+            uint16_t imageY = alongRow ? line : i;
+            uint16_t run = this->findRun(x + imageX, y + imageY, alongRow, lineLength - i, &descending);
+            uint16_t first = this->lookup(x + imageX, y + imageY);
+            LedStripColor* source = colors + (uint32_t) imageY * stride + imageX;
+
+            if(!descending && step == 1) {
+                // The run is contiguous in both the image and the strip, write it straight away
+                this->ledStrip->setLedColors(first, source, run);
+            } else {
+                // Gather the run in strip order, and write it in chunks
+                uint16_t lowest = descending ? first - (run - 1) : first;
+                for(uint16_t j = 0; j < run; j += LED_STRIP_ADAPTER_CHUNK_SIZE) {
+                    uint16_t count = run - j < LED_STRIP_ADAPTER_CHUNK_SIZE ? run - j : LED_STRIP_ADAPTER_CHUNK_SIZE;
+                    for(uint16_t k = 0; k < count; k++) {
+                        uint16_t element = descending ? run - 1 - (j + k) : j + k;
+                        chunk[k] = source[(uint32_t) element * step];
+                    }
+                    this->ledStrip->setLedColors(lowest + j, chunk, count);
+                }
+            }
+            i += run;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,279 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPMATRIX_H
+#define LEDSTRIPDRIVER_LEDSTRIPMATRIX_H
+
+#include "LedStripBase.h"
+#include "LedStripColor.h"
+
+/**
+ * Matrix layouts, describing how the LEDs of a panel are wired.
+ * Rows run along the panel width, columns along the panel height. Serpentine layouts reverse every other row or column.
+ */
+#define LED_STRIP_MATRIX_ROW_MAJOR 0
+#define LED_STRIP_MATRIX_ROW_SERPENTINE 1
+#define LED_STRIP_MATRIX_COLUMN_MAJOR 2
+#define LED_STRIP_MATRIX_COLUMN_SERPENTINE 3
+
+/**
+ * Matrix rotations, clockwise.
+ */
+#define LED_STRIP_MATRIX_ROTATE_0 0
+#define LED_STRIP_MATRIX_ROTATE_90 1
+#define LED_STRIP_MATRIX_ROTATE_180 2
+#define LED_STRIP_MATRIX_ROTATE_270 3
+
+/**
+ * Two dimensional view on an LED strip wired as a matrix panel.
+ * The mapping of each x, y coordinate to an LED index is computed once into a lookup table, either in RAM from a layout
+ * and rotation, or supplied precomputed in PROGMEM. Row, column and rectangle operations find the runs of consecutive
+ * LEDs in the table, and write each run to the LED strip with a single bulk write.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripMatrix {
+private:
+    /**
+     * LED strip.
+     */
+    LedStripBase* ledStrip;
+
+    /**
+     * Width of the matrix, after rotation.
+     */
+    uint16_t width;
+
+    /**
+     * Height of the matrix, after rotation.
+     */
+    uint16_t height;
+
+    /**
+     * LED index of each coordinate, row by row.
+     */
+    const uint16_t* table;
+
+    /**
+     * True if the table is in PROGMEM, false if it's in RAM.
+     */
+    bool progmemTable;
+
+    /**
+     * True if the table is owned by this instance.
+     */
+    bool ownsTable;
+
+    /**
+     * Get the LED index of the given coordinate from the table.
+     *
+     * @param x X coordinate, must be in range.
+     * @param y Y coordinate, must be in range.
+     *
+     * @return LED index.
+     */
+    inline uint16_t lookup(uint16_t x, uint16_t y) {
+        uint32_t i = (uint32_t) y * this->width + x;
+        return this->progmemTable ? pgm_read_word(&this->table[i]) : this->table[i];
+    }
+
+    /**
+     * Find the run of consecutive LED indices starting at the given coordinate, along a row or column.
+     *
+     * @param x X coordinate of the first LED, must be in range.
+     * @param y Y coordinate of the first LED, must be in range.
+     * @param alongRow True to walk along the row, false to walk along the column.
+     * @param maxCount Maximum run length.
+     * @param descending Returns true if the LED indices descend along the run, false if they ascend.
+     *
+     * @return Run length, at least 1.
+     */
+    uint16_t findRun(uint16_t x, uint16_t y, bool alongRow, uint16_t maxCount, bool* descending);
+
+    /**
+     * Clip a rectangle to the matrix.
+     *
+     * @param x X coordinate of the rectangle, returns the clipped coordinate.
+     * @param y Y coordinate of the rectangle, returns the clipped coordinate.
+     * @param width Width of the rectangle, returns the clipped width.
+     * @param height Height of the rectangle, returns the clipped height.
+     *
+     * @return True if part of the rectangle is on the matrix, false if not.
+     */
+    bool clipRect(uint16_t* x, uint16_t* y, uint16_t* width, uint16_t* height);
+
+    /**
+     * Check whether rectangles are best walked along rows, which gives longer runs for the layout.
+     *
+     * @return True to walk rows, false to walk columns.
+     */
+    bool prefersRows();
+
+public:
+    /**
+     * Constructor.
+     * The coordinate mapping is computed into a table in RAM, of two bytes per LED.
+     *
+     * @param ledStrip LED strip, which must outlive the matrix.
+     * @param panelWidth Width of the panel as wired, before rotation.
+     * @param panelHeight Height of the panel as wired, before rotation.
+     * @param layout Layout of the panel, LED_STRIP_MATRIX_ROW_MAJOR for example.
+     * @param rotation Rotation of the matrix, LED_STRIP_MATRIX_ROTATE_0 for example.
+     */
+    LedStripMatrix(LedStripBase* ledStrip, uint16_t panelWidth, uint16_t panelHeight, uint8_t layout,
+                   uint8_t rotation);
+
+    /**
+     * Constructor, for a precomputed mapping table in PROGMEM.
+     * The table holds the LED index of each coordinate, row by row, see mapLedIndex().
+     *
+     * @param ledStrip LED strip, which must outlive the matrix.
+     * @param width Width of the matrix.
+     * @param height Height of the matrix.
+     * @param progmemTable Mapping table in PROGMEM, of width * height entries.
+     */
+    LedStripMatrix(LedStripBase* ledStrip, uint16_t width, uint16_t height, const uint16_t* progmemTable);
+
+    /**
+     * Destructor.
+     */
+    ~LedStripMatrix();
+
+    /**
+     * Map a coordinate to the LED index, for the given panel.
+     * This may be used to generate a mapping table for PROGMEM.
+     *
+     * @param panelWidth Width of the panel as wired, before rotation.
+     * @param panelHeight Height of the panel as wired, before rotation.
+     * @param layout Layout of the panel.
+     * @param rotation Rotation of the matrix.
+     * @param x X coordinate, after rotation.
+     * @param y Y coordinate, after rotation.
+     *
+     * @return LED index.
+     */
+    static uint16_t mapLedIndex(uint16_t panelWidth, uint16_t panelHeight, uint8_t layout, uint8_t rotation,
+                                uint16_t x, uint16_t y);
+
+    /**
+     * Get the LED strip.
+     *
+     * @return LED strip.
+     */
+    LedStripBase* getLedStrip();
+
+    /**
+     * Get the width of the matrix.
+     *
+     * @return Width, after rotation.
+     */
+    uint16_t getWidth();
+
+    /**
+     * Get the height of the matrix.
+     *
+     * @return Height, after rotation.
+     */
+    uint16_t getHeight();
+
+    /**
+     * Get the LED index of the given coordinate.
+     *
+     * @param x X coordinate.
+     * @param y Y coordinate.
+     *
+     * @return LED index, or the LED count of the strip if the coordinate is outside the matrix.
+     */
+    uint16_t getLedIndex(uint16_t x, uint16_t y);
+
+    /**
+     * Get the color of the LED at the given coordinate.
+     *
+     * @param x X coordinate.
+     * @param y Y coordinate.
+     *
+     * @return LED color, black if the coordinate is outside the matrix.
+     */
+    LedStripColor getPixel(uint16_t x, uint16_t y);
+
+    /**
+     * Set the color of the LED at the given coordinate.
+     *
+     * @param x X coordinate.
+     * @param y Y coordinate.
+     * @param color LED color.
+     */
+    void setPixel(uint16_t x, uint16_t y, LedStripColor color);
+
+    /**
+     * Set the color of a part of a row.
+     *
+     * @param x X coordinate of the first LED.
+     * @param y Y coordinate of the row.
+     * @param count Number of LEDs.
+     * @param color LED color.
+     */
+    void fillRow(uint16_t x, uint16_t y, uint16_t count, LedStripColor color);
+
+    /**
+     * Set the color of a part of a column.
+     *
+     * @param x X coordinate of the column.
+     * @param y Y coordinate of the first LED.
+     * @param count Number of LEDs.
+     * @param color LED color.
+     */
+    void fillColumn(uint16_t x, uint16_t y, uint16_t count, LedStripColor color);
+
+    /**
+     * Set the color of a rectangle.
+     *
+     * @param x X coordinate of the rectangle.
+     * @param y Y coordinate of the rectangle.
+     * @param width Width of the rectangle.
+     * @param height Height of the rectangle.
+     * @param color LED color.
+     */
+    void fillRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height, LedStripColor color);
+
+    /**
+     * Set the color of all LEDs of the matrix.
+     *
+     * @param color LED color.
+     */
+    void fill(LedStripColor color);
+
+    /**
+     * Copy an image onto the matrix.
+     * Parts of the image outside the matrix are skipped.
+     *
+     * @param x X coordinate to copy the image to.
+     * @param y Y coordinate to copy the image to.
+     * @param width Width of the image.
+     * @param height Height of the image.
+     * @param colors Image colors, row by row.
+     */
+    void blit(uint16_t x, uint16_t y, uint16_t width, uint16_t height, LedStripColor* colors);
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPMATRIX_H
\ No newline at end of file
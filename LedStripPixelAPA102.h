@@ -0,0 +1,156 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPPIXELAPA102_H
+#define LEDSTRIPDRIVER_LEDSTRIPPIXELAPA102_H
+
+#include "LedStripColor.h"
+#include "LedStripPixelFormat.h"
+
+/**
+ * Native pixel traits of APA102 (and SK9822) type LED strips.
+ * Pixels are four bytes: a brightness byte holding three flag bits and a 5-bit global brightness, followed by the
+ * blue, green and red channels. The brightness is carried by the alpha channel of a color.
+ * The conversions are static and inline, and are shared by the APA102 adapter and its users.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripPixelAPA102 {
+public:
+    /**
+     * Number of bytes per pixel.
+     */
+    static constexpr uint8_t BYTES_PER_PIXEL = 4;
+
+    /**
+     * Number of value bits per channel.
+     */
+    static constexpr uint8_t BITS_PER_CHANNEL = 8;
+
+    /**
+     * Byte position of the brightness within a pixel.
+     */
+    static constexpr uint8_t BRIGHTNESS_INDEX = 0;
+
+    /**
+     * Byte position of the red channel within a pixel.
+     */
+    static constexpr uint8_t RED_INDEX = 3;
+
+    /**
+     * Byte position of the green channel within a pixel.
+     */
+    static constexpr uint8_t GREEN_INDEX = 2;
+
+    /**
+     * Byte position of the blue channel within a pixel.
+     */
+    static constexpr uint8_t BLUE_INDEX = 1;
+
+    /**
+     * Bits that are always set in the brightness byte.
+     */
+    static constexpr uint8_t BRIGHTNESS_FLAG_BITS = 0xE0;
+
+    /**
+     * Number of bytes in the start frame.
+     */
+    static constexpr uint8_t START_FRAME_SIZE = 4;
+
+    /**
+     * Get the number of bytes in the end frame for a strip with the given number of LEDs.
+     * Each LED delays the data by half a clock, so at least half a clock per LED is sent after the pixels to push the
+     * last ones through. SK9822 strips only latch the frame after another 32 zero bits, which are included.
+     *
+     * @param ledCount Number of LEDs.
+     *
+     * @return End frame size in bytes.
+     */
+    static inline uint16_t getEndFrameSize(uint16_t ledCount) {
+        return 4 + (ledCount + 15) / 16;
+    }
+
+    /**
+     * Get the runtime description of this pixel format.
+     * The brightness byte isn't part of the description, so generic writers leave the brightness of a pixel as is.
+     *
+     * @return Pixel format.
+     */
+    static inline LedStripPixelFormat getFormat() {
+        return LedStripPixelFormat(BYTES_PER_PIXEL, BITS_PER_CHANNEL, RED_INDEX, GREEN_INDEX, BLUE_INDEX, 0);
+    }
+
+    /**
+     * Encode an 8-bit alpha value to its native brightness byte.
+     *
+     * @param alpha Alpha value.
+     *
+     * @return Native brightness byte.
+     */
+    static inline uint8_t encodeBrightness(uint8_t alpha) {
+        return (uint8_t) (alpha >> 3) | BRIGHTNESS_FLAG_BITS;
+    }
+
+    /**
+     * Decode a native brightness byte to an 8-bit alpha value.
+     * The top brightness bits are replicated into the low bits, so 31 decodes to 255.
+     *
+     * @param native Native brightness byte.
+     *
+     * @return Alpha value.
+     */
+    static inline uint8_t decodeBrightness(uint8_t native) {
+        return (uint8_t) (native << 3) | (uint8_t) ((native >> 2) & 0x07);
+    }
+
+    /**
+     * Encode a color into a native pixel.
+     *
+     * @param pixel Native pixel.
+     * @param redChannel Color value of the red channel.
+     * @param greenChannel Color value of the green channel.
+     * @param blueChannel Color value of the blue channel.
+     * @param alphaChannel Alpha value, used as global brightness.
+     */
+    static inline void encode(uint8_t* pixel, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel,
+                              uint8_t alphaChannel) {
+        pixel[BRIGHTNESS_INDEX] = encodeBrightness(alphaChannel);
+        pixel[BLUE_INDEX] = blueChannel;
+        pixel[GREEN_INDEX] = greenChannel;
+        pixel[RED_INDEX] = redChannel;
+    }
+
+    /**
+     * Decode a native pixel into a color.
+     *
+     * @param pixel Native pixel.
+     *
+     * @return Color, with the brightness as alpha channel.
+     */
+    static inline LedStripColor decode(uint8_t* pixel) {
+        return LedStripColor(pixel[RED_INDEX], pixel[GREEN_INDEX], pixel[BLUE_INDEX],
+                             decodeBrightness(pixel[BRIGHTNESS_INDEX]));
+    }
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPPIXELAPA102_H
\ No newline at end of file
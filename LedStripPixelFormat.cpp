@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripPixelFormat.h"
+
+LedStripPixelFormat::LedStripPixelFormat(uint8_t bytesPerPixel, uint8_t bitsPerChannel,
+                                         uint8_t redIndex, uint8_t greenIndex, uint8_t blueIndex, uint8_t flagBits) {
+    // Set the fields
+    this->bytesPerPixel = bytesPerPixel;
+    this->bitsPerChannel = bitsPerChannel;
+    this->channelIndex[0] = redIndex;
+    this->channelIndex[1] = greenIndex;
+    this->channelIndex[2] = blueIndex;
+    this->flagBits = flagBits;
+}
+
+uint8_t LedStripPixelFormat::getBytesPerPixel() {
+    return this->bytesPerPixel;
+}
+
+uint8_t LedStripPixelFormat::getBitsPerChannel() {
+    return this->bitsPerChannel;
+}
+
+uint8_t LedStripPixelFormat::getChannelIndex(uint8_t channel) {
+    return this->channelIndex[channel];
+}
+
+uint8_t LedStripPixelFormat::getFlagBits() {
+    return this->flagBits;
+}
+
+uint8_t LedStripPixelFormat::encodeChannel(uint8_t value) {
+    return (uint8_t) (value >> (8 - this->bitsPerChannel)) | this->flagBits;
+}
+
+uint8_t LedStripPixelFormat::decodeChannel(uint8_t native) {
+    // Take the value bits to the top, and replicate them into the low bits
+    uint8_t value = (uint8_t) ((native & ~this->flagBits) << (8 - this->bitsPerChannel));
+    return value | (uint8_t) (value >> this->bitsPerChannel);
+}
+
+void LedStripPixelFormat::encode(uint8_t* pixel, LedStripColor color) {
+    pixel[this->channelIndex[0]] = this->encodeChannel(color.getRed());
+    pixel[this->channelIndex[1]] = this->encodeChannel(color.getGreen());
+    pixel[this->channelIndex[2]] = this->encodeChannel(color.getBlue());
+}
+
+LedStripColor LedStripPixelFormat::decode(uint8_t* pixel) {
+    return LedStripColor(this->decodeChannel(pixel[this->channelIndex[0]]),
+                         this->decodeChannel(pixel[this->channelIndex[1]]),
+                         this->decodeChannel(pixel[this->channelIndex[2]]));
+}
\ No newline at end of file
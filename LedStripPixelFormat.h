@@ -0,0 +1,141 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPPIXELFORMAT_H
+#define LEDSTRIPDRIVER_LEDSTRIPPIXELFORMAT_H
+
+#include "LedStripColor.h"
+
+/**
+ * Description of the native pixel format of an LED strip adapter's buffer.
+ * Each pixel takes a fixed number of bytes, one per color channel at a given position, holding the channel value in its
+ * lowest bits along with constant flag bits. This allows effects to encode a color once, and write the native pixel
+ * straight into the buffer, see LedStripAdapterBase::getNativePixels().
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripPixelFormat {
+private:
+    /**
+     * Number of bytes per pixel.
+     */
+    uint8_t bytesPerPixel;
+
+    /**
+     * Number of value bits per channel.
+     */
+    uint8_t bitsPerChannel;
+
+    /**
+     * Byte position of the red, green and blue channel within a pixel.
+     */
+    uint8_t channelIndex[3];
+
+    /**
+     * Bits that are always set in every channel byte.
+     */
+    uint8_t flagBits;
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param bytesPerPixel Number of bytes per pixel.
+     * @param bitsPerChannel Number of value bits per channel, 4 to 8.
+     * @param redIndex Byte position of the red channel within a pixel.
+     * @param greenIndex Byte position of the green channel within a pixel.
+     * @param blueIndex Byte position of the blue channel within a pixel.
+     * @param flagBits Bits that are always set in every channel byte.
+     */
+    LedStripPixelFormat(uint8_t bytesPerPixel, uint8_t bitsPerChannel,
+                        uint8_t redIndex, uint8_t greenIndex, uint8_t blueIndex, uint8_t flagBits);
+
+    /**
+     * Get the number of bytes per pixel.
+     *
+     * @return Bytes per pixel.
+     */
+    uint8_t getBytesPerPixel();
+
+    /**
+     * Get the number of value bits per channel.
+     *
+     * @return Bits per channel.
+     */
+    uint8_t getBitsPerChannel();
+
+    /**
+     * Get the byte position of the given channel within a pixel.
+     *
+     * @param channel Channel, 0 for red, 1 for green, 2 for blue.
+     *
+     * @return Byte position.
+     */
+    uint8_t getChannelIndex(uint8_t channel);
+
+    /**
+     * Get the bits that are always set in every channel byte.
+     *
+     * @return Flag bits.
+     */
+    uint8_t getFlagBits();
+
+    /**
+     * Encode an 8-bit channel value to its native byte.
+     *
+     * @param value Channel value.
+     *
+     * @return Native channel byte, including the flag bits.
+     */
+    uint8_t encodeChannel(uint8_t value);
+
+    /**
+     * Decode a native channel byte to an 8-bit channel value.
+     * The value bits are replicated into the low bits, so the full native range maps onto the full 8-bit range, and
+     * encoding the decoded value gives back the same native byte.
+     *
+     * @param native Native channel byte.
+     *
+     * @return Channel value.
+     */
+    uint8_t decodeChannel(uint8_t native);
+
+    /**
+     * Encode a color into a native pixel.
+     *
+     * @param pixel Native pixel, of getBytesPerPixel() bytes.
+     * @param color Color.
+     */
+    void encode(uint8_t* pixel, LedStripColor color);
+
+    /**
+     * Decode a native pixel into a color.
+     *
+     * @param pixel Native pixel, of getBytesPerPixel() bytes.
+     *
+     * @return Color.
+     */
+    LedStripColor decode(uint8_t* pixel);
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPPIXELFORMAT_H
\ No newline at end of file
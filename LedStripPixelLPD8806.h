@@ -0,0 +1,128 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPPIXELLPD8806_H
+#define LEDSTRIPDRIVER_LEDSTRIPPIXELLPD8806_H
+
+#include "LedStripColor.h"
+#include "LedStripPixelFormat.h"
+
+/**
+ * Native pixel traits of LPD8806 type LED strips.
+ * Pixels are three bytes in GRB order, each holding a 7-bit channel value with the high bit set.
+ * The conversions are static and inline, and are shared by the LPD8806 adapters.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripPixelLPD8806 {
+public:
+    /**
+     * Number of bytes per pixel.
+     */
+    static constexpr uint8_t BYTES_PER_PIXEL = 3;
+
+    /**
+     * Number of value bits per channel.
+     */
+    static constexpr uint8_t BITS_PER_CHANNEL = 7;
+
+    /**
+     * Byte position of the red channel within a pixel.
+     */
+    static constexpr uint8_t RED_INDEX = 1;
+
+    /**
+     * Byte position of the green channel within a pixel.
+     */
+    static constexpr uint8_t GREEN_INDEX = 0;
+
+    /**
+     * Byte position of the blue channel within a pixel.
+     */
+    static constexpr uint8_t BLUE_INDEX = 2;
+
+    /**
+     * Bits that are always set in every channel byte.
+     */
+    static constexpr uint8_t FLAG_BITS = 0x80;
+
+    /**
+     * Get the runtime description of this pixel format.
+     *
+     * @return Pixel format.
+     */
+    static inline LedStripPixelFormat getFormat() {
+        return LedStripPixelFormat(BYTES_PER_PIXEL, BITS_PER_CHANNEL, RED_INDEX, GREEN_INDEX, BLUE_INDEX, FLAG_BITS);
+    }
+
+    /**
+     * Encode an 8-bit channel value to its native byte.
+     *
+     * @param value Channel value.
+     *
+     * @return Native channel byte.
+     */
+    static inline uint8_t encodeChannel(uint8_t value) {
+        return (uint8_t) (value >> 1) | FLAG_BITS;
+    }
+
+    /**
+     * Decode a native channel byte to an 8-bit channel value.
+     * The top value bit is replicated into the low bit, so 0x7F decodes to 255, and encoding gives back the same byte.
+     *
+     * @param native Native channel byte.
+     *
+     * @return Channel value.
+     */
+    static inline uint8_t decodeChannel(uint8_t native) {
+        return (uint8_t) (native << 1) | (uint8_t) ((native >> 6) & 0x01);
+    }
+
+    /**
+     * Encode a color into a native pixel.
+     *
+     * @param pixel Native pixel.
+     * @param redChannel Color value of the red channel.
+     * @param greenChannel Color value of the green channel.
+     * @param blueChannel Color value of the blue channel.
+     */
+    static inline void encode(uint8_t* pixel, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel) {
+        pixel[GREEN_INDEX] = encodeChannel(greenChannel);
+        pixel[RED_INDEX] = encodeChannel(redChannel);
+        pixel[BLUE_INDEX] = encodeChannel(blueChannel);
+    }
+
+    /**
+     * Decode a native pixel into a color.
+     *
+     * @param pixel Native pixel.
+     *
+     * @return Color.
+     */
+    static inline LedStripColor decode(uint8_t* pixel) {
+        return LedStripColor(decodeChannel(pixel[RED_INDEX]), decodeChannel(pixel[GREEN_INDEX]),
+                             decodeChannel(pixel[BLUE_INDEX]));
+    }
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPPIXELLPD8806_H
\ No newline at end of file
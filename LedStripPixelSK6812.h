@@ -0,0 +1,144 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPPIXELSK6812_H
+#define LEDSTRIPDRIVER_LEDSTRIPPIXELSK6812_H
+
+#include "LedStripColor.h"
+#include "LedStripPixelFormat.h"
+
+/**
+ * Native pixel traits of SK6812 RGBW type LED strips.
+ * Pixels are four bytes in GRBW order, each holding an 8-bit channel value.
+ * The conversions are static and inline, and are shared by the SK6812 adapter and its users.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripPixelSK6812 {
+public:
+    /**
+     * Number of bytes per pixel.
+     */
+    static constexpr uint8_t BYTES_PER_PIXEL = 4;
+
+    /**
+     * Number of value bits per channel.
+     */
+    static constexpr uint8_t BITS_PER_CHANNEL = 8;
+
+    /**
+     * Byte position of the red channel within a pixel.
+     */
+    static constexpr uint8_t RED_INDEX = 1;
+
+    /**
+     * Byte position of the green channel within a pixel.
+     */
+    static constexpr uint8_t GREEN_INDEX = 0;
+
+    /**
+     * Byte position of the blue channel within a pixel.
+     */
+    static constexpr uint8_t BLUE_INDEX = 2;
+
+    /**
+     * Byte position of the white channel within a pixel.
+     */
+    static constexpr uint8_t WHITE_INDEX = 3;
+
+    /**
+     * Get the runtime description of this pixel format.
+     * The white channel isn't part of the description, so generic writers leave the white channel of a pixel as is.
+     *
+     * @return Pixel format.
+     */
+    static inline LedStripPixelFormat getFormat() {
+        return LedStripPixelFormat(BYTES_PER_PIXEL, BITS_PER_CHANNEL, RED_INDEX, GREEN_INDEX, BLUE_INDEX, 0);
+    }
+
+    /**
+     * Encode a color into a native pixel.
+     *
+     * @param pixel Native pixel.
+     * @param redChannel Color value of the red channel.
+     * @param greenChannel Color value of the green channel.
+     * @param blueChannel Color value of the blue channel.
+     * @param whiteChannel Color value of the white channel.
+     */
+    static inline void encode(uint8_t* pixel, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel,
+                              uint8_t whiteChannel) {
+        pixel[GREEN_INDEX] = greenChannel;
+        pixel[RED_INDEX] = redChannel;
+        pixel[BLUE_INDEX] = blueChannel;
+        pixel[WHITE_INDEX] = whiteChannel;
+    }
+
+    /**
+     * Encode a color into a native pixel, moving the part shared by all three channels to the white channel.
+     * The white value is the smallest of the three channels, which is subtracted from each of them. This only takes a
+     * few integer operations per pixel.
+     *
+     * @param pixel Native pixel.
+     * @param redChannel Color value of the red channel.
+     * @param greenChannel Color value of the green channel.
+     * @param blueChannel Color value of the blue channel.
+     */
+    static inline void encodeExtractWhite(uint8_t* pixel, uint8_t redChannel, uint8_t greenChannel,
+                                          uint8_t blueChannel) {
+        uint8_t white = redChannel < greenChannel ? redChannel : greenChannel;
+        if(blueChannel < white)
+            white = blueChannel;
+        encode(pixel, redChannel - white, greenChannel - white, blueChannel - white, white);
+    }
+
+    /**
+     * Decode a native pixel into a color, ignoring the white channel.
+     *
+     * @param pixel Native pixel.
+     *
+     * @return Color.
+     */
+    static inline LedStripColor decode(uint8_t* pixel) {
+        return LedStripColor(pixel[RED_INDEX], pixel[GREEN_INDEX], pixel[BLUE_INDEX]);
+    }
+
+    /**
+     * Decode a native pixel into a color, adding the white channel back into the color channels.
+     * This reverses encodeExtractWhite(), channels are clipped to the maximum color value.
+     *
+     * @param pixel Native pixel.
+     *
+     * @return Color.
+     */
+    static inline LedStripColor decodeMergeWhite(uint8_t* pixel) {
+        uint8_t white = pixel[WHITE_INDEX];
+        uint16_t redChannel = pixel[RED_INDEX] + white;
+        uint16_t greenChannel = pixel[GREEN_INDEX] + white;
+        uint16_t blueChannel = pixel[BLUE_INDEX] + white;
+        return LedStripColor(redChannel > LED_STRIP_COLOR_VALUE_MAX ? LED_STRIP_COLOR_VALUE_MAX : redChannel,
+                             greenChannel > LED_STRIP_COLOR_VALUE_MAX ? LED_STRIP_COLOR_VALUE_MAX : greenChannel,
+                             blueChannel > LED_STRIP_COLOR_VALUE_MAX ? LED_STRIP_COLOR_VALUE_MAX : blueChannel);
+    }
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPPIXELSK6812_H
\ No newline at end of file
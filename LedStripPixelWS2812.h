@@ -0,0 +1,99 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPPIXELWS2812_H
+#define LEDSTRIPDRIVER_LEDSTRIPPIXELWS2812_H
+
+#include "LedStripColor.h"
+#include "LedStripPixelFormat.h"
+
+/**
+ * Native pixel traits of WS2812 (NeoPixel) type LED strips.
+ * Pixels are three bytes in GRB order, each holding an 8-bit channel value.
+ * The conversions are static and inline, and are shared by the WS2812 adapter and its users.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripPixelWS2812 {
+public:
+    /**
+     * Number of bytes per pixel.
+     */
+    static constexpr uint8_t BYTES_PER_PIXEL = 3;
+
+    /**
+     * Number of value bits per channel.
+     */
+    static constexpr uint8_t BITS_PER_CHANNEL = 8;
+
+    /**
+     * Byte position of the red channel within a pixel.
+     */
+    static constexpr uint8_t RED_INDEX = 1;
+
+    /**
+     * Byte position of the green channel within a pixel.
+     */
+    static constexpr uint8_t GREEN_INDEX = 0;
+
+    /**
+     * Byte position of the blue channel within a pixel.
+     */
+    static constexpr uint8_t BLUE_INDEX = 2;
+
+    /**
+     * Get the runtime description of this pixel format.
+     *
+     * @return Pixel format.
+     */
+    static inline LedStripPixelFormat getFormat() {
+        return LedStripPixelFormat(BYTES_PER_PIXEL, BITS_PER_CHANNEL, RED_INDEX, GREEN_INDEX, BLUE_INDEX, 0);
+    }
+
+    /**
+     * Encode a color into a native pixel.
+     *
+     * @param pixel Native pixel.
+     * @param redChannel Color value of the red channel.
+     * @param greenChannel Color value of the green channel.
+     * @param blueChannel Color value of the blue channel.
+     */
+    static inline void encode(uint8_t* pixel, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel) {
+        pixel[GREEN_INDEX] = greenChannel;
+        pixel[RED_INDEX] = redChannel;
+        pixel[BLUE_INDEX] = blueChannel;
+    }
+
+    /**
+     * Decode a native pixel into a color.
+     *
+     * @param pixel Native pixel.
+     *
+     * @return Color.
+     */
+    static inline LedStripColor decode(uint8_t* pixel) {
+        return LedStripColor(pixel[RED_INDEX], pixel[GREEN_INDEX], pixel[BLUE_INDEX]);
+    }
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPPIXELWS2812_H
\ No newline at end of file
@@ -0,0 +1,56 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+/**
+ * Port registers of the bit-banged outputs.
+ *
+ * Adapters that bit-bang their data write the port registers directly where the core provides them. AVR ports are 8
+ * bits wide, SAMD ports 32 bits, and the host build simulates 8-bit ports. Other cores don't define
+ * LED_STRIP_PORT_REGISTERS, and the adapters fall back to digitalWrite() there.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPPORT_H
+#define LEDSTRIPDRIVER_LEDSTRIPPORT_H
+
+#include <Arduino.h>
+
+#if defined(__AVR__)
+#define LED_STRIP_PORT_REGISTERS
+typedef volatile uint8_t LedStripPortReg;
+typedef uint8_t LedStripPortMask;
+#elif defined(ARDUINO_ARCH_SAMD)
+#define LED_STRIP_PORT_REGISTERS
+typedef volatile uint32_t LedStripPortReg;
+typedef uint32_t LedStripPortMask;
+#elif defined(LED_STRIP_HOST)
+#define LED_STRIP_PORT_REGISTERS
+typedef HostPortRegister LedStripPortReg;
+typedef uint8_t LedStripPortMask;
+#else
+typedef volatile uint8_t LedStripPortReg;
+typedef uint8_t LedStripPortMask;
+#endif
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPPORT_H
\ No newline at end of file
@@ -0,0 +1,86 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripPowerBudget.h"
+
+LedStripPowerBudget::LedStripPowerBudget(uint16_t redCurrent, uint16_t greenCurrent, uint16_t blueCurrent,
+                                         uint16_t idleCurrent, uint32_t supplyCurrent) {
+    // Set the fields
+    this->setChannelCurrent(redCurrent, greenCurrent, blueCurrent);
+    this->idleCurrent = idleCurrent;
+    this->supplyCurrent = supplyCurrent;
+
+    // Nothing is tracked until an adapter starts using this budget
+    this->reset(0, 1);
+}
+
+void LedStripPowerBudget::setChannelCurrent(uint16_t redCurrent, uint16_t greenCurrent, uint16_t blueCurrent) {
+    this->channelCurrent[0] = redCurrent;
+    this->channelCurrent[1] = greenCurrent;
+    this->channelCurrent[2] = blueCurrent;
+}
+
+uint16_t LedStripPowerBudget::getIdleCurrent() {
+    return this->idleCurrent;
+}
+
+void LedStripPowerBudget::setIdleCurrent(uint16_t idleCurrent) {
+    this->idleCurrent = idleCurrent;
+}
+
+uint32_t LedStripPowerBudget::getSupplyCurrent() {
+    return this->supplyCurrent;
+}
+
+void LedStripPowerBudget::setSupplyCurrent(uint32_t supplyCurrent) {
+    this->supplyCurrent = supplyCurrent;
+}
+
+void LedStripPowerBudget::reset(uint16_t ledCount, uint8_t valueMax) {
+    this->ledCount = ledCount;
+    this->valueMax = valueMax > 0 ? valueMax : 1;
+    for(uint8_t channel = 0; channel < 3; channel++)
+        this->channelSum[channel] = 0;
+}
+
+uint32_t LedStripPowerBudget::getCurrent() {
+    // Each channel draws its full current times the average fraction of its full value, plus the idle current
+    uint32_t current = (uint32_t) this->idleCurrent * this->ledCount;
+    for(uint8_t channel = 0; channel < 3; channel++)
+        current += this->channelSum[channel] * this->channelCurrent[channel] / this->valueMax;
+    return current;
+}
+
+uint8_t LedStripPowerBudget::getScale() {
+    // Don't scale if there is no limit, or the frame is within it
+    if(this->supplyCurrent == 0)
+        return 255;
+    uint32_t current = this->getCurrent();
+    if(current <= this->supplyCurrent)
+        return 255;
+
+    // Divide what is left after the idle current over the channels
+    uint32_t idle = (uint32_t) this->idleCurrent * this->ledCount;
+    if(this->supplyCurrent <= idle)
+        return 0;
+    return (uint8_t) ((this->supplyCurrent - idle) * 255 / (current - idle));
+}
\ No newline at end of file
@@ -0,0 +1,170 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPPOWERBUDGET_H
+#define LEDSTRIPDRIVER_LEDSTRIPPOWERBUDGET_H
+
+#include <Arduino.h>
+
+/**
+ * Power model of an LED strip, used to keep its current draw within the budget of its supply.
+ * The draw of a frame is estimated from the sum of each color channel over all LEDs. The adapter keeps these sums up to
+ * date as pixels are written, so the estimate never needs a pass over the frame. When a frame is estimated to draw more
+ * than the budget, the adapter scales the whole frame down by getScale() while rendering it.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripPowerBudget {
+private:
+    /**
+     * Current drawn by each color channel of an LED at full output, in mA, in red, green, blue order.
+     */
+    uint16_t channelCurrent[3];
+
+    /**
+     * Current drawn by each LED while off, in mA.
+     */
+    uint16_t idleCurrent;
+
+    /**
+     * Current budget of the supply in mA, or 0 for no limit.
+     */
+    uint32_t supplyCurrent;
+
+    /**
+     * Number of LEDs being tracked.
+     */
+    uint16_t ledCount;
+
+    /**
+     * Channel value at full output, in the native units of the tracked strip.
+     */
+    uint8_t valueMax;
+
+    /**
+     * Sum of each color channel over all LEDs, in red, green, blue order.
+     */
+    uint32_t channelSum[3];
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param redCurrent Current drawn by the red channel of an LED at full output, in mA.
+     * @param greenCurrent Current drawn by the green channel of an LED at full output, in mA.
+     * @param blueCurrent Current drawn by the blue channel of an LED at full output, in mA.
+     * @param idleCurrent Current drawn by each LED while off, in mA.
+     * @param supplyCurrent Current budget of the supply in mA, or 0 for no limit.
+     */
+    LedStripPowerBudget(uint16_t redCurrent, uint16_t greenCurrent, uint16_t blueCurrent, uint16_t idleCurrent,
+                        uint32_t supplyCurrent);
+
+    /**
+     * Set the current drawn by each color channel of an LED at full output.
+     *
+     * @param redCurrent Current of the red channel in mA.
+     * @param greenCurrent Current of the green channel in mA.
+     * @param blueCurrent Current of the blue channel in mA.
+     */
+    void setChannelCurrent(uint16_t redCurrent, uint16_t greenCurrent, uint16_t blueCurrent);
+
+    /**
+     * Get the current drawn by each LED while off.
+     *
+     * @return Idle current in mA.
+     */
+    uint16_t getIdleCurrent();
+
+    /**
+     * Set the current drawn by each LED while off.
+     *
+     * @param idleCurrent Idle current in mA.
+     */
+    void setIdleCurrent(uint16_t idleCurrent);
+
+    /**
+     * Get the current budget of the supply.
+     *
+     * @return Supply current in mA, or 0 for no limit.
+     */
+    uint32_t getSupplyCurrent();
+
+    /**
+     * Set the current budget of the supply.
+     *
+     * @param supplyCurrent Supply current in mA, or 0 for no limit.
+     */
+    void setSupplyCurrent(uint32_t supplyCurrent);
+
+    /**
+     * Start tracking a strip, with all its LEDs off.
+     * Called by the adapter, which adds its current pixels afterwards.
+     *
+     * @param ledCount Number of LEDs on the strip.
+     * @param valueMax Channel value at full output, in the native units of the strip.
+     */
+    void reset(uint16_t ledCount, uint8_t valueMax);
+
+    /**
+     * Add the channel values of an LED to the sums.
+     *
+     * @param redChannel Native value of the red channel.
+     * @param greenChannel Native value of the green channel.
+     * @param blueChannel Native value of the blue channel.
+     */
+    inline void add(uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel) {
+        this->channelSum[0] += redChannel;
+        this->channelSum[1] += greenChannel;
+        this->channelSum[2] += blueChannel;
+    }
+
+    /**
+     * Remove the channel values of an LED from the sums.
+     *
+     * @param redChannel Native value of the red channel.
+     * @param greenChannel Native value of the green channel.
+     * @param blueChannel Native value of the blue channel.
+     */
+    inline void remove(uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel) {
+        this->channelSum[0] -= redChannel;
+        this->channelSum[1] -= greenChannel;
+        this->channelSum[2] -= blueChannel;
+    }
+
+    /**
+     * Get the estimated current draw of the tracked frame, before scaling.
+     *
+     * @return Current in mA.
+     */
+    uint32_t getCurrent();
+
+    /**
+     * Get the scale that brings the tracked frame within the budget.
+     * The idle current isn't affected by scaling, so only the remaining budget is divided over the color channels.
+     *
+     * @return Scale, 255 if the frame is within the budget or there is no limit.
+     */
+    uint8_t getScale();
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPPOWERBUDGET_H
\ No newline at end of file
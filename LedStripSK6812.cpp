@@ -0,0 +1,67 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripSK6812.h"
+
+#ifdef WS2812_PIN_OUTPUT
+LedStripSK6812::LedStripSK6812(uint16_t ledCount, uint8_t pinData) : LedStripBase(ledCount) {
+    // Set the fields
+    this->pinData = pinData;
+
+    // Configure and set the adapter
+    this->setAdapter(new LedStripAdapterSK6812(ledCount, pinData));
+}
+#endif
+
+LedStripSK6812::LedStripSK6812(uint16_t ledCount) : LedStripBase(ledCount) {
+    // The MOSI pin depends on the board
+    this->pinData = LED_STRIP_SK6812_PIN_HARDWARE_SPI;
+
+    // Configure and set the adapter
+    this->setAdapter(new LedStripAdapterSK6812(ledCount));
+}
+
+LedStripSK6812::~LedStripSK6812() { }
+
+uint8_t LedStripSK6812::getDataPin() {
+    return this->pinData;
+}
+
+LedStripAdapterSK6812* LedStripSK6812::getSK6812Adapter() {
+    return (LedStripAdapterSK6812*) this->getAdapter();
+}
+
+bool LedStripSK6812::isWhiteExtraction() {
+    return this->getSK6812Adapter()->isWhiteExtraction();
+}
+
+void LedStripSK6812::setWhiteExtraction(bool whiteExtraction) {
+    this->getSK6812Adapter()->setWhiteExtraction(whiteExtraction);
+}
+
+void LedStripSK6812::init() {
+    this->getAdapter()->init();
+}
+
+void LedStripSK6812::init(bool render) {
+    this->getAdapter()->init(render);
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPSK6812_H
+#define LEDSTRIPDRIVER_LEDSTRIPSK6812_H
+
+#include "LedStripBase.h"
+#include "LedStripAdapterSK6812.h"
+
+/**
+ * Pin number reported for the data pin of LED strips on the hardware SPI bus.
+ */
+#define LED_STRIP_SK6812_PIN_HARDWARE_SPI 0xFF
+
+/**
+ * LedStrip class for SK6812 RGBW type LED strips.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripSK6812 : public LedStripBase {
+private:
+    /**
+     * Pin used for data transfer to the LED strip.
+     */
+    uint8_t pinData;
+
+public:
+#ifdef WS2812_PIN_OUTPUT
+    /**
+     * Constructor, for LED strips driven directly from a pin.
+     *
+     * @param ledCount Number of LEDs on this LED strip.
+     * @param pinData Arduino PIN for data.
+     */
+    LedStripSK6812(uint16_t ledCount, uint8_t pinData);
+#endif
+
+    /**
+     * Constructor, for LED strips on the MOSI pin of the hardware SPI bus.
+     *
+     * @param ledCount Number of LEDs on this LED strip.
+     */
+    LedStripSK6812(uint16_t ledCount);
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "HidingNonVirtualFunction"
+    /**
+     * Destructor.
+     */
+    ~LedStripSK6812();
+#pragma clang diagnostic pop
+
+    /**
+     * Get the Arduino pin used for the data signal.
+     *
+     * @return Data pin, or LED_STRIP_SK6812_PIN_HARDWARE_SPI.
+     */
+    uint8_t getDataPin();
+
+    /**
+     * Get the SK6812 LED strip adapter.
+     *
+     * @return SK6812 LED strip adapter.
+     */
+    LedStripAdapterSK6812* getSK6812Adapter();
+
+    /**
+     * Check whether the white channel is extracted from RGB colors.
+     *
+     * @return True if enabled, false if not.
+     */
+    bool isWhiteExtraction();
+
+    /**
+     * Enable or disable white extraction, see LedStripAdapterSK6812::setWhiteExtraction().
+     *
+     * @param whiteExtraction True to enable, false to disable.
+     */
+    void setWhiteExtraction(bool whiteExtraction);
+
+    // Override virtual method in BaseLedStrip class
+    void init();
+
+    // Override virtual method in BaseLedStrip class
+    void init(bool render);
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPSK6812_H
\ No newline at end of file
@@ -0,0 +1,49 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripSegment.h"
+
+LedStripSegment::LedStripSegment(LedStripBase* parent, uint16_t offset, uint16_t length) :
+        LedStripSegment(parent, offset, length, false) { }
+
+LedStripSegment::LedStripSegment(LedStripBase* parent, uint16_t offset, uint16_t length, bool reversed) :
+        LedStripBase(length), segmentAdapter(parent->getAdapter(), offset, length, reversed) {
+    // Use the adapter embedded in this instance, so no memory is allocated
+    this->setAdapter(&this->segmentAdapter);
+}
+
+LedStripSegment::~LedStripSegment() {
+    // The adapter is embedded in this instance, make sure the base class doesn't delete it
+    this->setAdapter(NULL);
+}
+
+LedStripAdapterSegment* LedStripSegment::getSegmentAdapter() {
+    return &this->segmentAdapter;
+}
+
+void LedStripSegment::init() {
+    this->getAdapter()->init();
+}
+
+void LedStripSegment::init(bool render) {
+    this->getAdapter()->init(render);
+}
\ No newline at end of file
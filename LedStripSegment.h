@@ -0,0 +1,88 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPSEGMENT_H
+#define LEDSTRIPDRIVER_LEDSTRIPSEGMENT_H
+
+#include "LedStripBase.h"
+#include "LedStripAdapterSegment.h"
+
+/**
+ * Segment of an LED strip, controlled as an LED strip of its own.
+ * The segment is a view on a range of the parent strip, optionally in reversed direction. It has no buffer of its own,
+ * and doesn't allocate any memory, so effects such as the animations may target a segment directly. Several segments of
+ * one strip may be drawn independently, and rendered together by rendering the parent strip once.
+ * The parent strip must outlive its segments.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripSegment : public LedStripBase {
+private:
+    /**
+     * Segment adapter, owned by this segment instead of the base class.
+     */
+    LedStripAdapterSegment segmentAdapter;
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param parent Parent LED strip.
+     * @param offset Index of the first LED of the segment on the parent.
+     * @param length Number of LEDs in the segment.
+     */
+    LedStripSegment(LedStripBase* parent, uint16_t offset, uint16_t length);
+
+    /**
+     * Constructor.
+     *
+     * @param parent Parent LED strip.
+     * @param offset Index of the first LED of the segment on the parent.
+     * @param length Number of LEDs in the segment.
+     * @param reversed True if the segment runs in reversed direction on the parent, false if not.
+     */
+    LedStripSegment(LedStripBase* parent, uint16_t offset, uint16_t length, bool reversed);
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "HidingNonVirtualFunction"
+    /**
+     * Destructor.
+     */
+    ~LedStripSegment();
+#pragma clang diagnostic pop
+
+    /**
+     * Get the segment LED strip adapter.
+     *
+     * @return Segment LED strip adapter.
+     */
+    LedStripAdapterSegment* getSegmentAdapter();
+
+    // Override virtual method in BaseLedStrip class
+    void init();
+
+    // Override virtual method in BaseLedStrip class
+    void init(bool render);
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPSEGMENT_H
\ No newline at end of file
@@ -0,0 +1,193 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripSerialReceiver.h"
+
+LedStripSerialReceiver::LedStripSerialReceiver(LedStripBase* ledStrip, Stream* stream)
+        : nativeFormat(0, 8, 0, 1, 2, 0) {
+    this->ledStrip = ledStrip;
+    this->stream = stream;
+    this->timeout = LED_STRIP_SERIAL_RECEIVER_TIMEOUT;
+    this->reset();
+    this->resetStats();
+}
+
+void LedStripSerialReceiver::begin() {
+    this->stream->write((const uint8_t*) "Ada\n", 4);
+}
+
+bool LedStripSerialReceiver::update() {
+    unsigned long now = millis();
+
+    // Drop a partially received frame if the sender stalled
+    if(this->state != LED_STRIP_SERIAL_RECEIVER_STATE_MAGIC && now - this->lastReceiveTime > this->timeout) {
+        this->droppedFrameCount++;
+        this->reset();
+    }
+
+    uint8_t buffer[LED_STRIP_SERIAL_RECEIVER_CHUNK_SIZE];
+    int available;
+    while((available = this->stream->available()) > 0) {
+        this->lastReceiveTime = now;
+
+        // Parse the header byte by byte
+        if(this->state != LED_STRIP_SERIAL_RECEIVER_STATE_PAYLOAD) {
+            this->receiveHeader((uint8_t) this->stream->read());
+            continue;
+        }
+
+        // Don't write into the pixel buffer while the previous frame is still being transferred
+        if(this->frameLedIndex == 0 && this->frameChannel == 0 && !this->ledStrip->isRenderComplete()) {
+            if(!this->frameLate) {
+                this->frameLate = true;
+                this->lateFrameCount++;
+            }
+            return false;
+        }
+
+        // Read a chunk of the payload, but not beyond the end of this frame
+        uint32_t remaining = (this->frameLedCount - this->frameLedIndex) * 3 - this->frameChannel;
+        if(remaining > (uint32_t) available)
+            remaining = (uint32_t) available;
+        if(remaining > sizeof(buffer))
+            remaining = sizeof(buffer);
+        uint8_t length = (uint8_t) this->stream->readBytes(buffer, (size_t) remaining);
+        this->receivePayload(buffer, length);
+
+        // Render the frame once it's complete
+        if(this->frameLedIndex == this->frameLedCount) {
+            if(this->nativePixel != NULL)
+                this->ledStrip->getAdapter()->markNativePixelsChanged(
+                        0, this->frameLedCount < this->ledCount ? (uint16_t) this->frameLedCount : this->ledCount);
+            this->ledStrip->renderAsync();
+            this->frameCount++;
+            this->reset();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void LedStripSerialReceiver::receiveHeader(uint8_t value) {
+    // Match the magic word, restarting at a new first character on a mismatch
+    if(this->state == LED_STRIP_SERIAL_RECEIVER_STATE_MAGIC) {
+        if(value == (uint8_t) "Ada"[this->headerIndex])
+            this->headerIndex++;
+        else
+            this->headerIndex = value == 'A' ? 1 : 0;
+
+        if(this->headerIndex == 3) {
+            this->state = LED_STRIP_SERIAL_RECEIVER_STATE_HEADER;
+            this->headerIndex = 0;
+        }
+        return;
+    }
+
+    // Collect the LED count and checksum
+    this->header[this->headerIndex++] = value;
+    if(this->headerIndex < 3)
+        return;
+
+    // Verify the checksum, and drop the frame if it doesn't match
+    if((uint8_t) (this->header[0] ^ this->header[1] ^ 0x55) != this->header[2]) {
+        this->droppedFrameCount++;
+        this->reset();
+        return;
+    }
+
+    this->startPayload();
+}
+
+void LedStripSerialReceiver::startPayload() {
+    this->state = LED_STRIP_SERIAL_RECEIVER_STATE_PAYLOAD;
+    this->frameLedCount = ((uint32_t) this->header[0] << 8 | this->header[1]) + 1;
+    this->frameLedIndex = 0;
+    this->frameChannel = 0;
+    this->ledCount = this->ledStrip->getLedCount();
+
+    // Write into the native pixel buffer if the adapter exposes one
+    LedStripAdapterBase* adapter = this->ledStrip->getAdapter();
+    this->nativePixel = adapter->getPixelFormat(&this->nativeFormat) ? adapter->getNativePixels() : NULL;
+}
+
+void LedStripSerialReceiver::receivePayload(uint8_t* buffer, uint8_t length) {
+    for(uint8_t i = 0; i < length; i++) {
+        // Bytes for LEDs beyond the end of the strip are skipped
+        if(this->frameLedIndex < this->ledCount) {
+            if(this->nativePixel != NULL)
+                this->nativePixel[this->nativeFormat.getChannelIndex(this->frameChannel)] =
+                        this->nativeFormat.encodeChannel(buffer[i]);
+            else
+                this->frameColor[this->frameChannel] = buffer[i];
+        }
+
+        // Move to the next channel, and to the next LED after the last channel
+        if(++this->frameChannel < 3)
+            continue;
+        if(this->frameLedIndex < this->ledCount) {
+            if(this->nativePixel != NULL)
+                this->nativePixel += this->nativeFormat.getBytesPerPixel();
+            else
+                this->ledStrip->setLedColor((uint16_t) this->frameLedIndex,
+                                            this->frameColor[0], this->frameColor[1], this->frameColor[2]);
+        }
+        this->frameChannel = 0;
+        this->frameLedIndex++;
+    }
+}
+
+void LedStripSerialReceiver::reset() {
+    this->state = LED_STRIP_SERIAL_RECEIVER_STATE_MAGIC;
+    this->headerIndex = 0;
+    this->frameLedCount = 0;
+    this->frameLedIndex = 0;
+    this->frameChannel = 0;
+    this->frameLate = false;
+    this->nativePixel = NULL;
+}
+
+unsigned long LedStripSerialReceiver::getTimeout() {
+    return this->timeout;
+}
+
+void LedStripSerialReceiver::setTimeout(unsigned long timeout) {
+    this->timeout = timeout;
+}
+
+uint32_t LedStripSerialReceiver::getFrameCount() {
+    return this->frameCount;
+}
+
+uint32_t LedStripSerialReceiver::getDroppedFrameCount() {
+    return this->droppedFrameCount;
+}
+
+uint32_t LedStripSerialReceiver::getLateFrameCount() {
+    return this->lateFrameCount;
+}
+
+void LedStripSerialReceiver::resetStats() {
+    this->frameCount = 0;
+    this->droppedFrameCount = 0;
+    this->lateFrameCount = 0;
+}
\ No newline at end of file
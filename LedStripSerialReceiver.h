@@ -0,0 +1,228 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPSERIALRECEIVER_H
+#define LEDSTRIPDRIVER_LEDSTRIPSERIALRECEIVER_H
+
+#include <Arduino.h>
+
+#include "LedStripBase.h"
+#include "LedStripPixelFormat.h"
+
+/**
+ * Number of milliseconds without data after which a partially received frame is dropped.
+ */
+#define LED_STRIP_SERIAL_RECEIVER_TIMEOUT 250
+
+/**
+ * Number of payload bytes read from the stream at once.
+ */
+#define LED_STRIP_SERIAL_RECEIVER_CHUNK_SIZE 32
+
+/**
+ * Receiver states, waiting for the magic word, reading the frame header, or reading the frame payload.
+ */
+#define LED_STRIP_SERIAL_RECEIVER_STATE_MAGIC 0
+#define LED_STRIP_SERIAL_RECEIVER_STATE_HEADER 1
+#define LED_STRIP_SERIAL_RECEIVER_STATE_PAYLOAD 2
+
+/**
+ * Receiver of LED strip frames streamed over a serial port, using the Adalight protocol.
+ * Each frame starts with the magic word "Ada", followed by the high and low byte of the LED count minus one, and a
+ * checksum of both bytes XORed with 0x55. The payload follows, three bytes per LED in RGB order. This is the protocol
+ * spoken by Adalight compatible software such as Prismatik, Hyperion and Glediator.
+ *
+ * Payload bytes are converted while they're read, straight into the native pixel buffer if the adapter exposes one,
+ * see LedStripAdapterBase::getNativePixels(). Each complete frame is rendered in the background.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripSerialReceiver {
+private:
+    /**
+     * LED strip the frames are drawn on.
+     */
+    LedStripBase* ledStrip;
+
+    /**
+     * Stream the frames are read from.
+     */
+    Stream* stream;
+
+    /**
+     * Receiver state, see LED_STRIP_SERIAL_RECEIVER_STATE_MAGIC.
+     */
+    uint8_t state;
+
+    /**
+     * Number of magic word or header bytes received.
+     */
+    uint8_t headerIndex;
+
+    /**
+     * Received header bytes.
+     */
+    uint8_t header[3];
+
+    /**
+     * Number of LEDs in the frame being received, and number of LEDs received so far.
+     */
+    uint32_t frameLedCount, frameLedIndex;
+
+    /**
+     * Color channel of the next payload byte.
+     */
+    uint8_t frameChannel;
+
+    /**
+     * Received color channels of the LED being received, if there's no native pixel buffer.
+     */
+    uint8_t frameColor[3];
+
+    /**
+     * True if the frame being received has been counted as late.
+     */
+    bool frameLate;
+
+    /**
+     * Number of LEDs on the strip, when the frame being received started.
+     */
+    uint16_t ledCount;
+
+    /**
+     * Native pixel being received, or NULL if the adapter has no native pixel buffer.
+     */
+    uint8_t* nativePixel;
+
+    /**
+     * Format of the native pixel buffer.
+     */
+    LedStripPixelFormat nativeFormat;
+
+    /**
+     * Time in milliseconds data was last received.
+     */
+    unsigned long lastReceiveTime;
+
+    /**
+     * Number of milliseconds without data after which a partially received frame is dropped.
+     */
+    unsigned long timeout;
+
+    /**
+     * Number of frames received and rendered, dropped, and received while the previous frame was still rendering.
+     */
+    uint32_t frameCount, droppedFrameCount, lateFrameCount;
+
+    /**
+     * Handle a magic word or header byte.
+     *
+     * @param value Received byte.
+     */
+    void receiveHeader(uint8_t value);
+
+    /**
+     * Start receiving the payload of a frame, once its header has been verified.
+     */
+    void startPayload();
+
+    /**
+     * Convert received payload bytes into the pixel buffer.
+     *
+     * @param buffer Payload bytes.
+     * @param length Number of bytes.
+     */
+    void receivePayload(uint8_t* buffer, uint8_t length);
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param ledStrip Led strip instance pointer.
+     * @param stream Stream to read the frames from, such as &Serial.
+     */
+    LedStripSerialReceiver(LedStripBase* ledStrip, Stream* stream);
+
+    /**
+     * Announce the receiver to the sender, by writing "Ada" followed by a newline.
+     * Some senders wait for this to detect the port. The stream must be opened before.
+     */
+    void begin();
+
+    /**
+     * Read the available data from the stream, and render once a frame is complete.
+     * This doesn't wait for data, and should be called often enough to prevent the receive buffer from overflowing.
+     * The payload of a frame isn't read until the previous frame has been transferred to the strip.
+     *
+     * @return True if a frame was rendered, false if not.
+     */
+    bool update();
+
+    /**
+     * Drop the frame being received, and wait for the next one.
+     */
+    void reset();
+
+    /**
+     * Get the number of milliseconds without data after which a partially received frame is dropped.
+     *
+     * @return Timeout in milliseconds.
+     */
+    unsigned long getTimeout();
+
+    /**
+     * Set the number of milliseconds without data after which a partially received frame is dropped.
+     *
+     * @param timeout Timeout in milliseconds.
+     */
+    void setTimeout(unsigned long timeout);
+
+    /**
+     * Get the number of frames received and rendered.
+     *
+     * @return Frame count.
+     */
+    uint32_t getFrameCount();
+
+    /**
+     * Get the number of frames dropped, because of an invalid header checksum or because the sender stalled.
+     *
+     * @return Dropped frame count.
+     */
+    uint32_t getDroppedFrameCount();
+
+    /**
+     * Get the number of frames that arrived while the previous frame was still being transferred to the strip.
+     * These frames are delayed, and a growing count means the sender is faster than the strip can be rendered.
+     *
+     * @return Late frame count.
+     */
+    uint32_t getLateFrameCount();
+
+    /**
+     * Reset the frame counters.
+     */
+    void resetStats();
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPSERIALRECEIVER_H
\ No newline at end of file
@@ -0,0 +1,42 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripSimulated.h"
+
+LedStripSimulated::LedStripSimulated(uint16_t ledCount) : LedStripSimulated(ledCount, 1) { }
+
+LedStripSimulated::LedStripSimulated(uint16_t ledCount, uint8_t frameCapacity) : LedStripBase(ledCount) {
+    // Configure and set the adapter
+    this->setAdapter(new LedStripAdapterSimulated(ledCount, frameCapacity));
+}
+
+LedStripAdapterSimulated* LedStripSimulated::getSimulatedAdapter() {
+    return (LedStripAdapterSimulated*) this->getAdapter();
+}
+
+void LedStripSimulated::init() {
+    this->getAdapter()->init();
+}
+
+void LedStripSimulated::init(bool render) {
+    this->getAdapter()->init(render);
+}
\ No newline at end of file
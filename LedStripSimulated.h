@@ -0,0 +1,68 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPSIMULATED_H
+#define LEDSTRIPDRIVER_LEDSTRIPSIMULATED_H
+
+#include "LedStripBase.h"
+#include "LedStripAdapterSimulated.h"
+
+/**
+ * Simulated LED strip.
+ * This LED strip doesn't drive any hardware, rendered frames are recorded into memory instead.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripSimulated : public LedStripBase {
+public:
+    /**
+     * Constructor.
+     * This records the last rendered frame only.
+     *
+     * @param ledCount Number of LEDs on this LED strip.
+     */
+    LedStripSimulated(uint16_t ledCount);
+
+    /**
+     * Constructor.
+     *
+     * @param ledCount Number of LEDs on this LED strip.
+     * @param frameCapacity Number of rendered frames to keep in memory.
+     */
+    LedStripSimulated(uint16_t ledCount, uint8_t frameCapacity);
+
+    /**
+     * Get the simulated LED strip adapter, which holds the recorded frames.
+     *
+     * @return Simulated LED strip adapter.
+     */
+    LedStripAdapterSimulated* getSimulatedAdapter();
+
+    // Override virtual method in BaseLedStrip class
+    void init();
+
+    // Override virtual method in BaseLedStrip class
+    void init(bool render);
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPSIMULATED_H
\ No newline at end of file
@@ -0,0 +1,264 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPSTATIC_H
+#define LEDSTRIPDRIVER_LEDSTRIPSTATIC_H
+
+#include "LedStripColor.h"
+
+/**
+ * Compile-time specialized LED strip.
+ * The adapter type and LED count are template parameters, so there is no virtual dispatch and the pixel buffer is
+ * statically sized. Per-LED writes inline down to stores into the buffer.
+ *
+ * The adapter type must provide the static getBufferSize(), getLedColor(), setLedColor(), fillLedColors(),
+ * getColorChannelCount() and getColorValueMax() methods, a constructor taking the pixel buffer and LED count followed
+ * by any adapter specific arguments, and init(bool) and render() methods. See LedStripStaticAdapterLPD8806.
+ *
+ * Example: LedStripStatic<LedStripStaticAdapterLPD8806, 62> strip(DATA_PIN, CLOCK_PIN);
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+template<class Adapter, uint16_t LED_COUNT>
+class LedStripStatic {
+private:
+    /**
+     * Statically sized pixel buffer, in the native format of the adapter.
+     */
+    uint8_t pixels[Adapter::getBufferSize(LED_COUNT)];
+
+    /**
+     * LED strip adapter for the used LED strip type.
+     */
+    Adapter adapter;
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param args Adapter specific arguments, such as the data and clock pins.
+     */
+    template<typename... Args>
+    LedStripStatic(Args... args) : adapter(this->pixels, LED_COUNT, args...) { }
+
+    /**
+     * Initialize the LED strip.
+     * Required before the LED strip is used.
+     * This will automatically render the LED strip state once after initialization.
+     */
+    void init() {
+        this->adapter.init(true);
+    }
+
+    /**
+     * Initialize the LED strip.
+     * Required before the LED strip is used.
+     *
+     * @param render True to automatically render once after initialization, false if not.
+     */
+    void init(bool render) {
+        this->adapter.init(render);
+    }
+
+    /**
+     * Render the state of the LED strip to the physical hardware.
+     */
+    void render() {
+        this->adapter.render();
+    }
+
+    /**
+     * Get the number of LEDs this LED strip has.
+     *
+     * @return LED count.
+     */
+    static constexpr uint16_t getLedCount() {
+        return LED_COUNT;
+    }
+
+    /**
+     * Get the LED strip adapter instance.
+     *
+     * @return LED strip adapter.
+     */
+    Adapter* getAdapter() {
+        return &this->adapter;
+    }
+
+    /**
+     * Get the pixel buffer, in the native format of the adapter.
+     *
+     * @return Pixel buffer.
+     */
+    uint8_t* getPixels() {
+        return this->pixels;
+    }
+
+    /**
+     * Clear the LEDs on the LED strip.
+     * This will set all LEDs to black.
+     * This will automatically render the cleared LEDs.
+     */
+    void clear() {
+        this->clear(true);
+    }
+
+    /**
+     * Clear the LEDs on the LED strip.
+     * This will set all LEDs to black.
+     *
+     * @param render True to automatically render once after all LEDs have been cleared.
+     */
+    void clear(bool render) {
+        // Clear the LEDs
+        this->setAllLedColors(0, 0, 0);
+
+        // Render
+        if(render)
+            this->render();
+    }
+
+    /**
+     * Get the color of the given LED on the strip.
+     *
+     * @param ledIndex Index of the LED.
+     *
+     * @return LED color, or black if the index is out of bounds.
+     */
+    LedStripColor getLedColor(uint16_t ledIndex) {
+        if(ledIndex >= LED_COUNT)
+            return LedStripColor::black();
+        return Adapter::getLedColor(this->pixels, ledIndex);
+    }
+
+    /**
+     * Set the color of the given LED on the strip.
+     *
+     * @param ledIndex Index of the LED to configure.
+     * @param color LED color.
+     */
+    void setLedColor(uint16_t ledIndex, LedStripColor color) {
+        this->setLedColor(ledIndex, color.getRed(), color.getGreen(), color.getBlue());
+    }
+
+    /**
+     * Set the color using three color channels of the given LED on the strip.
+     *
+     * @param ledIndex Index of the LED to configure.
+     * @param redChannel Color value of the red channel (first channel).
+     * @param greenChannel Color value of the green channel (second channel).
+     * @param blueChannel Color value of the blue channel (third channel).
+     */
+    void setLedColor(uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel) {
+        if(ledIndex < LED_COUNT)
+            Adapter::setLedColor(this->pixels, ledIndex, redChannel, greenChannel, blueChannel);
+    }
+
+    /**
+     * Set the colors of a span of LEDs on the strip from a contiguous buffer of colors.
+     * LEDs beyond the end of the strip are ignored.
+     *
+     * @param fromLedIndex Index of the first LED to configure.
+     * @param colors Buffer of LED colors.
+     * @param count Number of colors in the buffer.
+     */
+    void setLedColors(uint16_t fromLedIndex, LedStripColor* colors, uint16_t count) {
+        // Clip the span to the strip once
+        if(fromLedIndex >= LED_COUNT)
+            return;
+        if(count > LED_COUNT - fromLedIndex)
+            count = LED_COUNT - fromLedIndex;
+
+        // Write the colors
+        for(uint16_t i = 0; i < count; i++)
+            Adapter::setLedColor(this->pixels, fromLedIndex + i,
+                                 colors[i].getRed(), colors[i].getGreen(), colors[i].getBlue());
+    }
+
+    /**
+     * Set the color of the LEDs in the given range on the strip.
+     *
+     * @param fromLedIndex From LED index.
+     * @param toLedIndex To LED index. (excluded)
+     * @param color LED color.
+     */
+    void setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex, LedStripColor color) {
+        this->setRangeLedColors(fromLedIndex, toLedIndex, color.getRed(), color.getGreen(), color.getBlue());
+    }
+
+    /**
+     * Set the color using three color channels of the LEDs in the given range on the strip.
+     *
+     * @param fromLedIndex From LED index.
+     * @param toLedIndex To LED index. (excluded)
+     * @param redChannel Color value of the red channel (first channel).
+     * @param greenChannel Color value of the green channel (second channel).
+     * @param blueChannel Color value of the blue channel (third channel).
+     */
+    void setRangeLedColors(uint16_t fromLedIndex, uint16_t toLedIndex,
+                           uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel) {
+        // Clip the range to the strip once
+        if(toLedIndex > LED_COUNT)
+            toLedIndex = LED_COUNT;
+
+        // Fill the range
+        if(fromLedIndex < toLedIndex)
+            Adapter::fillLedColors(this->pixels, fromLedIndex, toLedIndex, redChannel, greenChannel, blueChannel);
+    }
+
+    /**
+     * Set the color of all the LEDs on the strip.
+     *
+     * @param color LED color.
+     */
+    void setAllLedColors(LedStripColor color) {
+        this->setAllLedColors(color.getRed(), color.getGreen(), color.getBlue());
+    }
+
+    /**
+     * Set the color using three color channels of all the LEDs on the strip.
+     *
+     * @param redChannel Color value of the red channel (first channel).
+     * @param greenChannel Color value of the green channel (second channel).
+     * @param blueChannel Color value of the blue channel (third channel).
+     */
+    void setAllLedColors(uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel) {
+        Adapter::fillLedColors(this->pixels, 0, LED_COUNT, redChannel, greenChannel, blueChannel);
+    }
+
+    /**
+     * Get the number of color channels this LED strip has.
+     */
+    static constexpr uint8_t getColorChannelCount() {
+        return Adapter::getColorChannelCount();
+    }
+
+    /**
+     * Get the maximum color value for each color channel on this LED strip.
+     */
+    static constexpr uint8_t getColorValueMax() {
+        return Adapter::getColorValueMax();
+    }
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPSTATIC_H
\ No newline at end of file
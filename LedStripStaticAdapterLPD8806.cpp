@@ -0,0 +1,41 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripStaticAdapterLPD8806.h"
+
+LedStripStaticAdapterLPD8806::LedStripStaticAdapterLPD8806(uint8_t* pixels, uint16_t ledCount,
+                                                           uint8_t pinData, uint8_t pinClock)
+        : strip(ledCount, pinData, pinClock, pixels) { }
+
+void LedStripStaticAdapterLPD8806::init(bool render) {
+    // Initialize/begin the LED strip
+    this->strip.begin();
+
+    // Render the LED strip
+    if(render)
+        this->render();
+}
+
+void LedStripStaticAdapterLPD8806::render() {
+    // Render the LED strip
+    this->strip.show();
+}
\ No newline at end of file
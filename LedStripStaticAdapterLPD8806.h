@@ -0,0 +1,149 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPSTATICADAPTERLPD8806_H
+#define LEDSTRIPDRIVER_LEDSTRIPSTATICADAPTERLPD8806_H
+
+#include "LedStripLPD8806Helper.h"
+#include "LedStripColor.h"
+#include "LedStripAdapterLPD8806.h"
+#include "LedStripPixelLPD8806.h"
+
+/**
+ * Compile-time LED strip adapter for LPD8806 type LED strips, used by LedStripStatic.
+ * Unlike LedStripAdapterLPD8806, this adapter has no virtual methods and doesn't own the pixel buffer.
+ * The pixel methods are static and inline, so they compile down to plain stores into the given buffer.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripStaticAdapterLPD8806 {
+private:
+    /**
+     * LPD8806 strip instance, transmitting the caller-owned pixel buffer.
+     */
+    LPD8806 strip;
+
+public:
+    /**
+     * Get the size of the pixel buffer required for the given number of LEDs.
+     * This includes the latch bytes following the pixel data.
+     *
+     * @param ledCount Number of LEDs.
+     *
+     * @return Buffer size in bytes.
+     */
+    static constexpr uint16_t getBufferSize(uint16_t ledCount) {
+        return ledCount * 3 + (ledCount + 31) / 32;
+    }
+
+    /**
+     * Constructor.
+     *
+     * @param pixels Pixel buffer of at least getBufferSize(ledCount) bytes.
+     * @param ledCount Number of LEDs.
+     * @param pinData Data pin.
+     * @param pinClock Clock pin.
+     */
+    LedStripStaticAdapterLPD8806(uint8_t* pixels, uint16_t ledCount, uint8_t pinData, uint8_t pinClock);
+
+    /**
+     * Initialize the LED strip.
+     * Required before it's used.
+     *
+     * @param render True to automatically render once after initialization, false if not.
+     */
+    void init(bool render);
+
+    /**
+     * Render the state of the LED strip to the physical hardware.
+     */
+    void render();
+
+    /**
+     * Get the color of the given LED in the pixel buffer.
+     *
+     * @param pixels Pixel buffer.
+     * @param ledIndex Index of the LED.
+     *
+     * @return LED color.
+     */
+    static inline LedStripColor getLedColor(uint8_t* pixels, uint16_t ledIndex) {
+        return LedStripPixelLPD8806::decode(pixels + ledIndex * LedStripPixelLPD8806::BYTES_PER_PIXEL);
+    }
+
+    /**
+     * Set the color of the given LED in the pixel buffer.
+     *
+     * @param pixels Pixel buffer.
+     * @param ledIndex Index of the LED.
+     * @param redChannel Color value of the red channel.
+     * @param greenChannel Color value of the green channel.
+     * @param blueChannel Color value of the blue channel.
+     */
+    static inline void setLedColor(uint8_t* pixels, uint16_t ledIndex,
+                                   uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel) {
+        LedStripPixelLPD8806::encode(pixels + ledIndex * LedStripPixelLPD8806::BYTES_PER_PIXEL,
+                                     redChannel, greenChannel, blueChannel);
+    }
+
+    /**
+     * Fill the given range of the pixel buffer with a single color.
+     *
+     * @param pixels Pixel buffer.
+     * @param fromLedIndex From LED index.
+     * @param toLedIndex To LED index. (excluded)
+     * @param redChannel Color value of the red channel.
+     * @param greenChannel Color value of the green channel.
+     * @param blueChannel Color value of the blue channel.
+     */
+    static inline void fillLedColors(uint8_t* pixels, uint16_t fromLedIndex, uint16_t toLedIndex,
+                                     uint8_t redChannel, uint8_t greenChannel, uint8_t blueChannel) {
+        // Translate the color to the native pixel once
+        uint8_t native[LedStripPixelLPD8806::BYTES_PER_PIXEL];
+        LedStripPixelLPD8806::encode(native, redChannel, greenChannel, blueChannel);
+
+        // Fill the pixel buffer
+        uint8_t* pixel = pixels + fromLedIndex * LedStripPixelLPD8806::BYTES_PER_PIXEL;
+        for(uint16_t i = fromLedIndex; i < toLedIndex; i++) {
+            *pixel++ = native[0];
+            *pixel++ = native[1];
+            *pixel++ = native[2];
+        }
+    }
+
+    /**
+     * Get the number of color channels this LED strip has.
+     */
+    static constexpr uint8_t getColorChannelCount() {
+        return LPD8806_COLOR_CHANNEL_COUNT;
+    }
+
+    /**
+     * Get the maximum color value for each color channel on this LED strip.
+     */
+    static constexpr uint8_t getColorValueMax() {
+        return LPD8806_COLOR_VALUE_MAX;
+    }
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPSTATICADAPTERLPD8806_H
\ No newline at end of file
@@ -0,0 +1,184 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripTimeline.h"
+
+LedStripTimeline::LedStripTimeline(LedStripBase* ledStrip, const uint8_t* program, bool progmem, unsigned long wait)
+        : LedStripAnimation(ledStrip, wait) {
+    this->program = program;
+    this->progmem = progmem;
+    this->reset();
+}
+
+void LedStripTimeline::reset() {
+    LedStripAnimation::reset();
+
+    // Start right after the version byte, with the whole strip selected
+    this->programCounter = 1;
+    this->stepOpcode = LED_STRIP_TIMELINE_OP_END;
+    this->stepDuration = 0;
+    this->stepStart = 0;
+    this->stepFromColor = LedStripColor::black();
+    this->color = LedStripColor::black();
+    this->segmentFrom = 0;
+    this->segmentTo = LED_STRIP_TIMELINE_SEGMENT_END;
+    this->loopCounter = 0;
+}
+
+uint8_t LedStripTimeline::readByte(uint16_t offset) {
+    return this->progmem ? pgm_read_byte(this->program + offset) : this->program[offset];
+}
+
+uint16_t LedStripTimeline::readWord(uint16_t offset) {
+    return (uint16_t) this->readByte(offset) | (uint16_t) this->readByte(offset + 1) << 8;
+}
+
+bool LedStripTimeline::executeInstruction() {
+    // Read the opcode, and move past the instruction operands as they're read
+    uint16_t pc = this->programCounter;
+    uint8_t opcode = this->readByte(pc++);
+
+    switch(opcode) {
+        case LED_STRIP_TIMELINE_OP_SEGMENT:
+            this->segmentFrom = this->readWord(pc);
+            this->segmentTo = this->readWord(pc + 2);
+            this->programCounter = pc + 4;
+            return true;
+
+        case LED_STRIP_TIMELINE_OP_FILL:
+            this->color = LedStripColor(this->readByte(pc), this->readByte(pc + 1), this->readByte(pc + 2));
+            this->programCounter = pc + 3;
+            this->drawStep(0);
+            return true;
+
+        case LED_STRIP_TIMELINE_OP_FADE:
+        case LED_STRIP_TIMELINE_OP_WIPE:
+            // Remember the color to start from, and start the instruction
+            this->stepFromColor = this->color;
+            this->color = LedStripColor(this->readByte(pc), this->readByte(pc + 1), this->readByte(pc + 2));
+            this->stepOpcode = opcode;
+            this->stepDuration = this->readWord(pc + 3);
+            this->programCounter = pc + 5;
+            return true;
+
+        case LED_STRIP_TIMELINE_OP_RAINBOW:
+        case LED_STRIP_TIMELINE_OP_HOLD:
+            this->stepOpcode = opcode;
+            this->stepDuration = this->readWord(pc);
+            this->programCounter = pc + 2;
+            return true;
+
+        case LED_STRIP_TIMELINE_OP_LOOP: {
+            // Start counting the passes when the loop is first reached, jump back until the last pass is done
+            uint8_t count = this->readByte(pc + 2);
+            if(this->loopCounter == 0)
+                this->loopCounter = count;
+            if(count == 0 || --this->loopCounter > 0)
+                this->programCounter = this->readWord(pc);
+            else
+                this->programCounter = pc + 3;
+            return true;
+        }
+
+        default:
+            // The end of the program, or an unknown instruction which we can't skip
+            return false;
+    }
+}
+
+void LedStripTimeline::drawStep(unsigned long time) {
+    // Clip the selected LEDs to the strip
+    uint16_t ledCount = this->ledStrip->getLedCount();
+    uint16_t from = this->segmentFrom < ledCount ? this->segmentFrom : ledCount;
+    uint16_t to = this->segmentTo < ledCount ? this->segmentTo : ledCount;
+    if(from >= to)
+        return;
+
+    // Determine the progress in 8-bit fixed point, the instruction is complete at the end of its duration
+    bool complete = time >= this->stepDuration;
+    uint8_t amount = complete ? 0xFF : (uint8_t) ((time << 8) / this->stepDuration);
+
+    switch(this->stepOpcode) {
+        case LED_STRIP_TIMELINE_OP_FADE:
+            this->ledStrip->setRangeLedColors(from, to,
+                                              complete ? this->color :
+                                              LedStripColor::blend(this->stepFromColor, this->color, amount));
+            break;
+
+        case LED_STRIP_TIMELINE_OP_WIPE:
+            this->ledStrip->setRangeLedColors(from, complete ? to : from + (uint16_t) (((uint32_t) (to - from) * time) /
+                                                                                     this->stepDuration), this->color);
+            break;
+
+        case LED_STRIP_TIMELINE_OP_RAINBOW:
+            this->ledStrip->setRangeLedColorsFromWheel(from, to, complete ? 0 : (uint16_t) (
+                    ((uint32_t) LED_STRIP_COLOR_WHEEL_SIZE * time) / this->stepDuration),
+                    (uint32_t) LED_STRIP_COLOR_WHEEL_SIZE * LED_STRIP_COLOR_WHEEL_STEP / (to - from));
+            break;
+
+        case LED_STRIP_TIMELINE_OP_HOLD:
+            break;
+
+        default:
+            // Instant fill with the current color
+            this->ledStrip->setRangeLedColors(from, to, this->color);
+            break;
+    }
+}
+
+bool LedStripTimeline::drawFrame(uint32_t) {
+    unsigned long elapsed = this->getElapsedTime();
+    bool drawn = false;
+
+    for(uint8_t i = 0; i < LED_STRIP_TIMELINE_FRAME_INSTRUCTIONS_MAX; i++) {
+        // Start the next instruction if none is being played, stop at the end of the program
+        if(this->stepOpcode == LED_STRIP_TIMELINE_OP_END) {
+            // Check the program version on the first instruction
+            if(this->programCounter == 1 && this->readByte(0) != LED_STRIP_TIMELINE_VERSION)
+                return false;
+
+            // Render whatever was drawn in this frame before finishing
+            if(!this->executeInstruction())
+                return drawn;
+            drawn = true;
+            continue;
+        }
+
+        // Draw the instruction being played, and return unless it completed
+        unsigned long time = elapsed - this->stepStart;
+        this->drawStep(time);
+        drawn = true;
+        if(time < this->stepDuration)
+            return true;
+
+        // Move on to the next instruction, starting exactly where this one ended to prevent drifting
+        this->stepStart += this->stepDuration;
+        this->stepOpcode = LED_STRIP_TIMELINE_OP_END;
+    }
+
+    // Continue in the next frame if an instruction loop didn't reach a timed instruction
+    return true;
+}
+
+uint16_t LedStripTimeline::getProgramCounter() {
+    return this->programCounter;
+}
\ No newline at end of file
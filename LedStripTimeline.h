@@ -0,0 +1,211 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPTIMELINE_H
+#define LEDSTRIPDRIVER_LEDSTRIPTIMELINE_H
+
+#include <Arduino.h>
+
+#include "LedStripBase.h"
+#include "LedStripColor.h"
+#include "LedStripAnimation.h"
+
+/**
+ * Version of the timeline program format, stored in the first byte of each program.
+ */
+#define LED_STRIP_TIMELINE_VERSION 1
+
+/**
+ * End of the program. (no operands)
+ */
+#define LED_STRIP_TIMELINE_OP_END 0x00
+
+/**
+ * Select the LEDs the following instructions apply to. (from, to: 16-bit, 0xFFFF for the end of the strip)
+ */
+#define LED_STRIP_TIMELINE_OP_SEGMENT 0x01
+
+/**
+ * Set the selected LEDs to a color at once. (red, green, blue)
+ */
+#define LED_STRIP_TIMELINE_OP_FILL 0x02
+
+/**
+ * Fade the selected LEDs from the last color to a new color. (red, green, blue, duration: 16-bit)
+ */
+#define LED_STRIP_TIMELINE_OP_FADE 0x03
+
+/**
+ * Wipe a new color over the selected LEDs. (red, green, blue, duration: 16-bit)
+ */
+#define LED_STRIP_TIMELINE_OP_WIPE 0x04
+
+/**
+ * Cycle a fitted rainbow over the selected LEDs once. (duration: 16-bit)
+ */
+#define LED_STRIP_TIMELINE_OP_RAINBOW 0x05
+
+/**
+ * Keep the LEDs as they are. (duration: 16-bit)
+ */
+#define LED_STRIP_TIMELINE_OP_HOLD 0x06
+
+/**
+ * Jump back to a program offset, to play a section a number of times in total. (offset: 16-bit, count, 0 for forever)
+ */
+#define LED_STRIP_TIMELINE_OP_LOOP 0x07
+
+/**
+ * Segment bound selecting the end of the strip.
+ */
+#define LED_STRIP_TIMELINE_SEGMENT_END 0xFFFF
+
+/**
+ * Maximum number of instructions executed for a single frame.
+ * This prevents a loop without any timed instruction from blocking.
+ */
+#define LED_STRIP_TIMELINE_FRAME_INSTRUCTIONS_MAX 32
+
+/**
+ * Non-blocking interpreter of compact binary keyframe programs.
+ * A program is a version byte followed by instructions, each an opcode byte followed by its operands. 16-bit operands
+ * are stored little-endian, and durations are in milliseconds. Programs may be stored in PROGMEM, so shows can be
+ * changed without touching the sketch logic. See host/LedStripTimelineCompiler.cpp for a compiler of a text format.
+ *
+ * Each update draws the state of the running instruction at the elapsed time, so the frame rate only affects the
+ * smoothness and not the duration of the show.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripTimeline : public LedStripAnimation {
+private:
+    /**
+     * Program to execute.
+     */
+    const uint8_t* program;
+
+    /**
+     * True if the program is stored in PROGMEM, false if it's in RAM.
+     */
+    bool progmem;
+
+    /**
+     * Offset of the next instruction in the program.
+     */
+    uint16_t programCounter;
+
+    /**
+     * Opcode of the timed instruction being played, LED_STRIP_TIMELINE_OP_END if none.
+     */
+    uint8_t stepOpcode;
+
+    /**
+     * Duration of the timed instruction being played, in milliseconds.
+     */
+    uint16_t stepDuration;
+
+    /**
+     * Elapsed time the timed instruction being played started at, in milliseconds.
+     */
+    unsigned long stepStart;
+
+    /**
+     * Color the timed instruction being played started from.
+     */
+    LedStripColor stepFromColor;
+
+    /**
+     * Last color set on the selected LEDs, and the target color of the timed instruction being played.
+     */
+    LedStripColor color;
+
+    /**
+     * Selected LEDs, from index and to index. (excluded)
+     */
+    uint16_t segmentFrom, segmentTo;
+
+    /**
+     * Number of passes left of the running loop, 0 if no loop is running.
+     */
+    uint8_t loopCounter;
+
+    /**
+     * Read a byte from the program.
+     *
+     * @param offset Program offset.
+     *
+     * @return Byte value.
+     */
+    uint8_t readByte(uint16_t offset);
+
+    /**
+     * Read a little-endian 16-bit value from the program.
+     *
+     * @param offset Program offset.
+     *
+     * @return Value.
+     */
+    uint16_t readWord(uint16_t offset);
+
+    /**
+     * Execute the next instruction.
+     * Instant instructions are applied to the LED strip, timed instructions are started.
+     *
+     * @return False if the end of the program was reached, true otherwise.
+     */
+    bool executeInstruction();
+
+    /**
+     * Draw the timed instruction being played at the given time.
+     *
+     * @param time Time since the start of the instruction in milliseconds, at most its duration.
+     */
+    void drawStep(unsigned long time);
+
+protected:
+    // Override virtual method in LedStripAnimation class
+    bool drawFrame(uint32_t frame);
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param ledStrip Led strip instance pointer.
+     * @param program Program to execute, must stay available while the timeline is used.
+     * @param progmem True if the program is stored in PROGMEM, false if it's in RAM.
+     * @param wait Number of milliseconds to wait between each frame.
+     */
+    LedStripTimeline(LedStripBase* ledStrip, const uint8_t* program, bool progmem, unsigned long wait);
+
+    // Override virtual method in LedStripAnimation class
+    void reset();
+
+    /**
+     * Get the offset of the next instruction in the program.
+     *
+     * @return Program offset.
+     */
+    uint16_t getProgramCounter();
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPTIMELINE_H
\ No newline at end of file
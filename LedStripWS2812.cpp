@@ -0,0 +1,59 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include "LedStripWS2812.h"
+
+#ifdef WS2812_PIN_OUTPUT
+LedStripWS2812::LedStripWS2812(uint16_t ledCount, uint8_t pinData) : LedStripBase(ledCount) {
+    // Set the fields
+    this->pinData = pinData;
+
+    // Configure and set the adapter
+    this->setAdapter(new LedStripAdapterWS2812(ledCount, pinData));
+}
+#endif
+
+LedStripWS2812::LedStripWS2812(uint16_t ledCount) : LedStripBase(ledCount) {
+    // The MOSI pin depends on the board
+    this->pinData = LED_STRIP_WS2812_PIN_HARDWARE_SPI;
+
+    // Configure and set the adapter
+    this->setAdapter(new LedStripAdapterWS2812(ledCount));
+}
+
+LedStripWS2812::~LedStripWS2812() { }
+
+uint8_t LedStripWS2812::getDataPin() {
+    return this->pinData;
+}
+
+LedStripAdapterWS2812* LedStripWS2812::getWS2812Adapter() {
+    return (LedStripAdapterWS2812*) this->getAdapter();
+}
+
+void LedStripWS2812::init() {
+    this->getAdapter()->init();
+}
+
+void LedStripWS2812::init(bool render) {
+    this->getAdapter()->init(render);
+}
\ No newline at end of file
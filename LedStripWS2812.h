@@ -0,0 +1,94 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#ifndef LEDSTRIPDRIVER_LEDSTRIPWS2812_H
+#define LEDSTRIPDRIVER_LEDSTRIPWS2812_H
+
+#include "LedStripBase.h"
+#include "LedStripAdapterWS2812.h"
+
+/**
+ * Pin number reported for the data pin of LED strips on the hardware SPI bus.
+ */
+#define LED_STRIP_WS2812_PIN_HARDWARE_SPI 0xFF
+
+/**
+ * LedStrip class for WS2812 (NeoPixel) type LED strips.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+class LedStripWS2812 : public LedStripBase {
+private:
+    /**
+     * Pin used for data transfer to the LED strip.
+     */
+    uint8_t pinData;
+
+public:
+#ifdef WS2812_PIN_OUTPUT
+    /**
+     * Constructor, for LED strips driven directly from a pin.
+     *
+     * @param ledCount Number of LEDs on this LED strip.
+     * @param pinData Arduino PIN for data.
+     */
+    LedStripWS2812(uint16_t ledCount, uint8_t pinData);
+#endif
+
+    /**
+     * Constructor, for LED strips on the MOSI pin of the hardware SPI bus.
+     *
+     * @param ledCount Number of LEDs on this LED strip.
+     */
+    LedStripWS2812(uint16_t ledCount);
+
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "HidingNonVirtualFunction"
+    /**
+     * Destructor.
+     */
+    ~LedStripWS2812();
+#pragma clang diagnostic pop
+
+    /**
+     * Get the Arduino pin used for the data signal.
+     *
+     * @return Data pin, or LED_STRIP_WS2812_PIN_HARDWARE_SPI.
+     */
+    uint8_t getDataPin();
+
+    /**
+     * Get the WS2812 LED strip adapter.
+     *
+     * @return WS2812 LED strip adapter.
+     */
+    LedStripAdapterWS2812* getWS2812Adapter();
+
+    // Override virtual method in BaseLedStrip class
+    void init();
+
+    // Override virtual method in BaseLedStrip class
+    void init(bool render);
+};
+
+#endif // LEDSTRIPDRIVER_LEDSTRIPWS2812_H
\ No newline at end of file
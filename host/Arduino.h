@@ -0,0 +1,234 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+/**
+ * Minimal Arduino core shim for host builds.
+ *
+ * This provides just enough of the Arduino API for the LED strip driver to compile and run on a regular computer,
+ * for off-target testing and profiling. Time is simulated: millis() and micros() follow the host clock, while delay()
+ * advances the simulated time instantly instead of sleeping. Pin writes are recorded but drive nothing.
+ * Pins are grouped in simulated 8-bit output ports, which may be captured to check bit-banged output.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+
+#ifndef LEDSTRIPDRIVER_HOST_ARDUINO_H
+#define LEDSTRIPDRIVER_HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#define PROGMEM
+#define pgm_read_byte(address) (*(const uint8_t*) (address))
+#define pgm_read_word(address) (*(const uint16_t*) (address))
+#define pgm_read_dword(address) (*(const uint32_t*) (address))
+
+// The host has no interrupts to mask
+#define noInterrupts()
+#define interrupts()
+
+#define HOST_PIN_COUNT 64
+#define HOST_PORT_COUNT (HOST_PIN_COUNT / 8)
+
+/**
+ * Simulated 8-bit output port register.
+ * Behaves like a volatile AVR PORTx register, and records the written values if capturing.
+ */
+class HostPortRegister {
+private:
+    /**
+     * Current port value.
+     */
+    uint8_t value;
+
+    /**
+     * Record a new port value.
+     *
+     * @param value Port value.
+     */
+    void write(uint8_t value);
+
+public:
+    HostPortRegister() : value(0) { }
+
+    operator uint8_t() const {
+        return this->value;
+    }
+
+    HostPortRegister& operator=(uint8_t value) {
+        this->write(value);
+        return *this;
+    }
+
+    HostPortRegister& operator|=(uint8_t mask) {
+        this->write(this->value | mask);
+        return *this;
+    }
+
+    HostPortRegister& operator&=(uint8_t mask) {
+        this->write(this->value & mask);
+        return *this;
+    }
+};
+
+#define digitalPinToPort(pin) ((uint8_t) ((pin) / 8))
+#define digitalPinToBitMask(pin) ((uint8_t) (1 << ((pin) % 8)))
+#define portOutputRegister(port) hostGetPortRegister(port)
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+/**
+ * Get the number of digitalWrite() calls made so far, to profile bit-banged output on the host.
+ *
+ * @return Digital write count.
+ */
+uint32_t hostGetDigitalWriteCount();
+
+/**
+ * Get the simulated output register of the given port.
+ *
+ * @param port Port number, see digitalPinToPort().
+ *
+ * @return Port register.
+ */
+HostPortRegister* hostGetPortRegister(uint8_t port);
+
+/**
+ * Capture every value written to the given port register into a buffer, until it is full.
+ *
+ * @param port Port number.
+ * @param buffer Capture buffer, or NULL to stop capturing.
+ * @param size Size of the capture buffer.
+ */
+void hostSetPortCapture(uint8_t port, uint8_t* buffer, uint32_t size);
+
+/**
+ * Get the number of port values captured.
+ *
+ * @return Capture length.
+ */
+uint32_t hostGetPortCaptureLength();
+
+/**
+ * Minimal Arduino Stream shim, the interface of serial ports and other byte streams.
+ */
+class Stream {
+public:
+    virtual ~Stream() { }
+
+    /**
+     * Get the number of bytes that can be read without blocking.
+     */
+    virtual int available() = 0;
+
+    /**
+     * Read a byte.
+     *
+     * @return Byte value, or -1 if none is available.
+     */
+    virtual int read() = 0;
+
+    /**
+     * Read bytes into a buffer, up to the given length or until none are available.
+     *
+     * @return Number of bytes read.
+     */
+    virtual size_t readBytes(char* buffer, size_t length);
+
+    size_t readBytes(uint8_t* buffer, size_t length) {
+        return this->readBytes((char*) buffer, length);
+    }
+
+    /**
+     * Write a byte.
+     *
+     * @return Number of bytes written.
+     */
+    virtual size_t write(uint8_t value) = 0;
+
+    /**
+     * Write bytes from a buffer.
+     *
+     * @return Number of bytes written.
+     */
+    virtual size_t write(const uint8_t* buffer, size_t size);
+};
+
+/**
+ * Stream over a host file descriptor, such as the master side of a pseudo-terminal.
+ * This allows serial protocols to be tested on the host, by any program writing to the terminal.
+ */
+class HostFileStream : public Stream {
+private:
+    /**
+     * File descriptor.
+     */
+    int fd;
+
+public:
+    /**
+     * Constructor.
+     *
+     * @param fd File descriptor, set to non-blocking mode.
+     */
+    HostFileStream(int fd);
+
+    int available();
+
+    int read();
+
+    size_t readBytes(char* buffer, size_t length);
+
+    size_t write(uint8_t value);
+
+    size_t write(const uint8_t* buffer, size_t size);
+};
+
+#endif // LEDSTRIPDRIVER_HOST_ARDUINO_H
\ No newline at end of file
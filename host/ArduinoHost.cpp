@@ -0,0 +1,278 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+#include <chrono>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include "Arduino.h"
+#include "SPI.h"
+
+/**
+ * Simulated time offset in microseconds, advanced by delay().
+ */
+static uint64_t delayOffset = 0;
+
+/**
+ * Pin states written by digitalWrite().
+ */
+static uint8_t pinStates[HOST_PIN_COUNT];
+
+/**
+ * Number of digitalWrite() calls.
+ */
+static uint32_t digitalWriteCount = 0;
+
+/**
+ * Simulated output port registers.
+ */
+static HostPortRegister portRegisters[HOST_PORT_COUNT];
+
+/**
+ * Port register being captured, or NULL.
+ */
+static HostPortRegister* portCaptureRegister = NULL;
+
+/**
+ * Port capture buffer.
+ */
+static uint8_t* portCapture = NULL;
+
+/**
+ * Size of the port capture buffer.
+ */
+static uint32_t portCaptureSize = 0;
+
+/**
+ * Number of captured port values.
+ */
+static uint32_t portCaptureLength = 0;
+
+/**
+ * Get the number of microseconds elapsed on the host clock since the first call.
+ */
+static uint64_t hostMicros() {
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return (uint64_t) std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start
+    ).count();
+}
+
+void pinMode(uint8_t, uint8_t) { }
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    if(pin < HOST_PIN_COUNT)
+        pinStates[pin] = value;
+    digitalWriteCount++;
+}
+
+int digitalRead(uint8_t pin) {
+    return pin < HOST_PIN_COUNT ? pinStates[pin] : LOW;
+}
+
+unsigned long millis() {
+    return (unsigned long) ((hostMicros() + delayOffset) / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long) (hostMicros() + delayOffset);
+}
+
+void delay(unsigned long ms) {
+    delayOffset += (uint64_t) ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us) {
+    delayOffset += us;
+}
+
+long random(long max) {
+    return max > 0 ? rand() % max : 0;
+}
+
+long random(long min, long max) {
+    return min < max ? min + random(max - min) : min;
+}
+
+void randomSeed(unsigned long seed) {
+    srand((unsigned int) seed);
+}
+
+uint32_t hostGetDigitalWriteCount() {
+    return digitalWriteCount;
+}
+
+void HostPortRegister::write(uint8_t value) {
+    this->value = value;
+    if(this == portCaptureRegister && portCaptureLength < portCaptureSize)
+        portCapture[portCaptureLength++] = value;
+}
+
+HostPortRegister* hostGetPortRegister(uint8_t port) {
+    return port < HOST_PORT_COUNT ? &portRegisters[port] : NULL;
+}
+
+void hostSetPortCapture(uint8_t port, uint8_t* buffer, uint32_t size) {
+    portCaptureRegister = buffer != NULL ? hostGetPortRegister(port) : NULL;
+    portCapture = buffer;
+    portCaptureSize = buffer != NULL ? size : 0;
+    portCaptureLength = 0;
+}
+
+uint32_t hostGetPortCaptureLength() {
+    return portCaptureLength;
+}
+
+size_t Stream::readBytes(char* buffer, size_t length) {
+    size_t count = 0;
+    int value;
+    while(count < length && (value = this->read()) >= 0)
+        buffer[count++] = (char) value;
+    return count;
+}
+
+size_t Stream::write(const uint8_t* buffer, size_t size) {
+    size_t count = 0;
+    while(count < size && this->write(buffer[count]) == 1)
+        count++;
+    return count;
+}
+
+HostFileStream::HostFileStream(int fd) {
+    this->fd = fd;
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+}
+
+int HostFileStream::available() {
+    int count = 0;
+    return ioctl(this->fd, FIONREAD, &count) == 0 ? count : 0;
+}
+
+int HostFileStream::read() {
+    uint8_t value;
+    return ::read(this->fd, &value, 1) == 1 ? value : -1;
+}
+
+size_t HostFileStream::readBytes(char* buffer, size_t length) {
+    ssize_t count = ::read(this->fd, buffer, length);
+    return count > 0 ? (size_t) count : 0;
+}
+
+size_t HostFileStream::write(uint8_t value) {
+    return this->write(&value, 1);
+}
+
+size_t HostFileStream::write(const uint8_t* buffer, size_t size) {
+    ssize_t count = ::write(this->fd, buffer, size);
+    return count > 0 ? (size_t) count : 0;
+}
+
+SPIClass SPI;
+
+SPIClass::SPIClass() {
+    this->transferCount = 0;
+    this->capture = NULL;
+    this->captureSize = 0;
+    this->captureLength = 0;
+    this->clock = 0;
+    this->loopbackClock = 0;
+    this->interruptHandler = NULL;
+    this->transferPending = false;
+}
+
+void SPIClass::begin() { }
+
+void SPIClass::end() { }
+
+void SPIClass::setBitOrder(uint8_t) { }
+
+void SPIClass::setDataMode(uint8_t) { }
+
+void SPIClass::setClockDivider(uint8_t) { }
+
+void SPIClass::beginTransaction(SPISettings settings) {
+    this->clock = settings.clock;
+}
+
+void SPIClass::endTransaction() {
+    this->clock = 0;
+}
+
+uint8_t SPIClass::transfer(uint8_t data) {
+    // Count and capture the byte
+    this->transferCount++;
+    if(this->capture != NULL && this->captureLength < this->captureSize)
+        this->capture[this->captureLength++] = data;
+
+    // Read back through the loopback, if connected
+    if(this->loopbackClock == 0)
+        return 0;
+    return this->clock <= this->loopbackClock ? data : (uint8_t) (data ^ 0x01);
+}
+
+void SPIClass::attachInterrupt(void (*handler)()) {
+    this->interruptHandler = handler;
+}
+
+void SPIClass::detachInterrupt() {
+    this->interruptHandler = NULL;
+}
+
+void SPIClass::transferAsync(uint8_t data) {
+    this->transfer(data);
+    this->transferPending = true;
+}
+
+bool SPIClass::runInterrupt() {
+    // Complete the pending transfer
+    if(!this->transferPending)
+        return false;
+    this->transferPending = false;
+
+    // Run the interrupt handler, which may issue the next byte
+    if(this->interruptHandler != NULL)
+        this->interruptHandler();
+    return true;
+}
+
+uint32_t SPIClass::getClock() {
+    return this->clock;
+}
+
+void SPIClass::setLoopback(uint32_t maxClock) {
+    this->loopbackClock = maxClock;
+}
+
+uint32_t SPIClass::getTransferCount() {
+    return this->transferCount;
+}
+
+void SPIClass::setCapture(uint8_t* buffer, uint32_t size) {
+    this->capture = buffer;
+    this->captureSize = buffer != NULL ? size : 0;
+    this->captureLength = 0;
+}
+
+uint32_t SPIClass::getCaptureLength() {
+    return this->captureLength;
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+/**
+ * Host tests of the APA102 adapter output.
+ * A small frame is rendered through hardware SPI and through the bit-banged pins, and the captured bytes are compared
+ * with the expected start frame, pixels and end frame.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+
+#include <string.h>
+
+#include "LedStripDriver.h"
+#include "LedStripTest.h"
+
+/**
+ * Number of LEDs of the test strips.
+ */
+const uint16_t TEST_LED_COUNT = 3;
+
+/**
+ * Data pin of the bit-banged strip, on the same simulated port as the clock pin.
+ */
+const uint8_t TEST_PIN_DATA = 2;
+
+/**
+ * Clock pin of the bit-banged strip.
+ */
+const uint8_t TEST_PIN_CLOCK = 3;
+
+/**
+ * Expected frame: a zeroed start frame, 0xE0 | brightness followed by blue, green and red for each LED, and an end
+ * frame of four bytes plus a byte for every 16 LEDs.
+ */
+const uint8_t EXPECTED_FRAME[] = {
+    0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xF0, 0x03, 0x02, 0x01,
+    0xFF, 0x30, 0x20, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+/**
+ * Size of the expected frame.
+ */
+const uint32_t EXPECTED_FRAME_SIZE = sizeof(EXPECTED_FRAME);
+
+/**
+ * Set the test colors on an adapter.
+ *
+ * @param adapter APA102 adapter.
+ */
+static void setTestColors(LedStripAdapterAPA102* adapter) {
+    adapter->setLedColor(0, LedStripColor::red());
+    adapter->setLedColor(1, 1, 2, 3, 128);
+    adapter->setLedColor(2, 0x10, 0x20, 0x30);
+}
+
+/**
+ * Check the layout of the expected frame against the pixel format, so the literal above stays in sync with it.
+ */
+static void testFrameLayout() {
+    TEST_CHECK_EQUAL(EXPECTED_FRAME_SIZE, LedStripPixelAPA102::START_FRAME_SIZE +
+                                          TEST_LED_COUNT * LedStripPixelAPA102::BYTES_PER_PIXEL +
+                                          LedStripPixelAPA102::getEndFrameSize(TEST_LED_COUNT));
+    TEST_CHECK_EQUAL(LedStripPixelAPA102::getEndFrameSize(TEST_LED_COUNT), 5);
+    TEST_CHECK_EQUAL(LedStripPixelAPA102::getEndFrameSize(16), 5);
+    TEST_CHECK_EQUAL(LedStripPixelAPA102::getEndFrameSize(17), 6);
+}
+
+/**
+ * Render a frame through hardware SPI, and compare the transferred bytes.
+ */
+static void testRenderSpi() {
+    LedStripAdapterAPA102 adapter(TEST_LED_COUNT, APA102_SPI_CLOCK_DEFAULT);
+    adapter.init();
+    setTestColors(&adapter);
+
+    // Capture the frame, with room to spare to catch extra bytes
+    uint8_t capture[EXPECTED_FRAME_SIZE + 8];
+    SPI.setCapture(capture, sizeof(capture));
+    adapter.render();
+    TEST_CHECK_EQUAL(SPI.getCaptureLength(), EXPECTED_FRAME_SIZE);
+    SPI.setCapture(NULL, 0);
+    TEST_CHECK(memcmp(capture, EXPECTED_FRAME, EXPECTED_FRAME_SIZE) == 0);
+
+    // The transaction must be ended
+    TEST_CHECK_EQUAL(SPI.getClock(), 0);
+}
+
+/**
+ * Render a frame through the bit-banged pins, and compare the bytes sampled on the rising clock edges.
+ */
+static void testRenderBitbang() {
+    LedStripAdapterAPA102 adapter(TEST_LED_COUNT, TEST_PIN_DATA, TEST_PIN_CLOCK);
+    adapter.init();
+    setTestColors(&adapter);
+
+    // Capture each write to the port, the data and clock pin are each written once or twice per bit
+    uint8_t capture[EXPECTED_FRAME_SIZE * 8 * 4];
+    hostSetPortCapture(digitalPinToPort(TEST_PIN_DATA), capture, sizeof(capture));
+    adapter.render();
+    uint32_t captureLength = hostGetPortCaptureLength();
+    hostSetPortCapture(0, NULL, 0);
+    TEST_CHECK(captureLength < sizeof(capture));
+
+    // Sample the data pin on each rising clock edge, the clock idles low
+    uint8_t frame[EXPECTED_FRAME_SIZE + 1];
+    uint8_t dataMask = digitalPinToBitMask(TEST_PIN_DATA);
+    uint8_t clockMask = digitalPinToBitMask(TEST_PIN_CLOCK);
+    uint32_t bits = 0;
+    bool clock = false;
+    memset(frame, 0, sizeof(frame));
+    for(uint32_t i = 0; i < captureLength; i++) {
+        bool edge = !clock && (capture[i] & clockMask);
+        clock = (capture[i] & clockMask) != 0;
+        if(!edge)
+            continue;
+        if(bits < sizeof(frame) * 8 && (capture[i] & dataMask))
+            frame[bits / 8] |= (uint8_t) (0x80 >> (bits % 8));
+        bits++;
+    }
+
+    // The clock must end low, after exactly the bits of the frame
+    TEST_CHECK(!clock);
+    TEST_CHECK_EQUAL(bits, EXPECTED_FRAME_SIZE * 8);
+    TEST_CHECK(memcmp(frame, EXPECTED_FRAME, EXPECTED_FRAME_SIZE) == 0);
+}
+
+int main() {
+    testFrameLayout();
+    testRenderSpi();
+    testRenderBitbang();
+    return testResult("LedStripAPA102Test");
+}
\ No newline at end of file
@@ -0,0 +1,329 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+/**
+ * Host-side LED strip driver benchmark.
+ * Measures the hot paths of the driver on the host, to compare implementations before flashing.
+ * Absolute numbers differ greatly from AVR targets, but the relative cost of each path is representative.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+
+#include <stdio.h>
+#include <chrono>
+
+#include "LedStripDriver.h"
+
+/**
+ * Number of LEDs used for the benchmarks.
+ */
+const uint16_t BENCHMARK_LED_COUNT = 600;
+
+/**
+ * Number of frames each benchmark runs.
+ */
+const uint16_t BENCHMARK_FRAMES = 2000;
+
+/**
+ * Benchmark clock type.
+ */
+typedef std::chrono::steady_clock BenchmarkClock;
+
+/**
+ * Report the result of a benchmark.
+ *
+ * @param name Benchmark name.
+ * @param start Start time of the benchmark.
+ * @param frames Number of frames.
+ * @param ledCount Number of LEDs per frame.
+ */
+static void report(const char* name, BenchmarkClock::time_point start, uint32_t frames, uint32_t ledCount) {
+    double nanos = std::chrono::duration<double, std::nano>(BenchmarkClock::now() - start).count();
+    printf("%-40s %10.2f ns/LED %12.1f us/frame\n", name, nanos / frames / ledCount, nanos / frames / 1000.0);
+}
+
+/**
+ * Compare per-LED writes against the bulk span and range writes of the LPD8806 adapter.
+ */
+static void benchmarkAdapterWrites() {
+    LedStripAdapterLPD8806 adapter(BENCHMARK_LED_COUNT, 2, 3);
+    LedStripColor* colors = new LedStripColor[BENCHMARK_LED_COUNT];
+    uint32_t* combined = new uint32_t[BENCHMARK_LED_COUNT];
+    BenchmarkClock::time_point start;
+
+    // Per-LED writes of a color buffer
+    start = BenchmarkClock::now();
+    for(uint16_t frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+        for(uint16_t i = 0; i < BENCHMARK_LED_COUNT; i++)
+            colors[i] = LedStripColor((uint8_t) (i + frame), (uint8_t) frame, (uint8_t) i);
+        for(uint16_t i = 0; i < BENCHMARK_LED_COUNT; i++)
+            adapter.setLedColor(i, colors[i]);
+    }
+    report("setLedColor, per LED", start, BENCHMARK_FRAMES, BENCHMARK_LED_COUNT);
+
+    // Bulk write of a color buffer
+    start = BenchmarkClock::now();
+    for(uint16_t frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+        for(uint16_t i = 0; i < BENCHMARK_LED_COUNT; i++)
+            colors[i] = LedStripColor((uint8_t) (i + frame), (uint8_t) frame, (uint8_t) i);
+        adapter.setLedColors(0, colors, BENCHMARK_LED_COUNT);
+    }
+    report("setLedColors, bulk", start, BENCHMARK_FRAMES, BENCHMARK_LED_COUNT);
+
+    // Per-LED writes of a combined channel buffer
+    start = BenchmarkClock::now();
+    for(uint16_t frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+        for(uint16_t i = 0; i < BENCHMARK_LED_COUNT; i++)
+            combined[i] = (uint32_t) (i + frame) << 24 | (uint32_t) frame << 8;
+        for(uint16_t i = 0; i < BENCHMARK_LED_COUNT; i++)
+            adapter.setLedColorCombinedChannels(i, combined[i]);
+    }
+    report("setLedColorCombinedChannels, per LED", start, BENCHMARK_FRAMES, BENCHMARK_LED_COUNT);
+
+    // Bulk write of a combined channel buffer
+    start = BenchmarkClock::now();
+    for(uint16_t frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+        for(uint16_t i = 0; i < BENCHMARK_LED_COUNT; i++)
+            combined[i] = (uint32_t) (i + frame) << 24 | (uint32_t) frame << 8;
+        adapter.setLedColorsCombinedChannels(0, combined, BENCHMARK_LED_COUNT);
+    }
+    report("setLedColorsCombinedChannels, bulk", start, BENCHMARK_FRAMES, BENCHMARK_LED_COUNT);
+
+    // Bulk write of a combined channel buffer, through the gamma and brightness lookup table
+    adapter.setGamma(2.2f);
+    adapter.setBrightness(128);
+    start = BenchmarkClock::now();
+    for(uint16_t frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+        for(uint16_t i = 0; i < BENCHMARK_LED_COUNT; i++)
+            combined[i] = (uint32_t) (i + frame) << 24 | (uint32_t) frame << 8;
+        adapter.setLedColorsCombinedChannels(0, combined, BENCHMARK_LED_COUNT);
+    }
+    report("setLedColorsCombinedChannels, corrected", start, BENCHMARK_FRAMES, BENCHMARK_LED_COUNT);
+    adapter.setGamma(1.0f);
+    adapter.setBrightness(LED_STRIP_COLOR_VALUE_MAX);
+
+    // Bulk write of a combined channel buffer, keeping the power budget up to date
+    LedStripPowerBudget powerBudget(20, 20, 20, 1, 2000);
+    adapter.setPowerBudget(&powerBudget);
+    start = BenchmarkClock::now();
+    for(uint16_t frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+        for(uint16_t i = 0; i < BENCHMARK_LED_COUNT; i++)
+            combined[i] = (uint32_t) (i + frame) << 24 | (uint32_t) frame << 8;
+        adapter.setLedColorsCombinedChannels(0, combined, BENCHMARK_LED_COUNT);
+    }
+    report("setLedColorsCombinedChannels, budgeted", start, BENCHMARK_FRAMES, BENCHMARK_LED_COUNT);
+    adapter.setPowerBudget(NULL);
+
+    // Range fill through the generic per-LED loop
+    start = BenchmarkClock::now();
+    for(uint16_t frame = 0; frame < BENCHMARK_FRAMES; frame++)
+        adapter.LedStripAdapterBase::setRangeLedColors(0, BENCHMARK_LED_COUNT, LedStripColor((uint8_t) frame, 0, 0));
+    report("setRangeLedColors, per LED", start, BENCHMARK_FRAMES, BENCHMARK_LED_COUNT);
+
+    // Range fill through the adapter fill
+    start = BenchmarkClock::now();
+    for(uint16_t frame = 0; frame < BENCHMARK_FRAMES; frame++)
+        adapter.setRangeLedColors(0, BENCHMARK_LED_COUNT, LedStripColor((uint8_t) frame, 0, 0));
+    report("setRangeLedColors, bulk", start, BENCHMARK_FRAMES, BENCHMARK_LED_COUNT);
+
+    delete[] colors;
+    delete[] combined;
+}
+
+/**
+ * Compare per-LED color wheel lookups against the batch wheel fill.
+ */
+static void benchmarkWheel() {
+    LedStripAdapterLPD8806 adapter(BENCHMARK_LED_COUNT, 2, 3);
+    BenchmarkClock::time_point start;
+
+    // Per-LED wheel lookups, as done by the rainbow animations
+    start = BenchmarkClock::now();
+    for(uint16_t frame = 0; frame < BENCHMARK_FRAMES; frame++)
+        for(uint16_t i = 0; i < BENCHMARK_LED_COUNT; i++)
+            adapter.setLedColor(i, LedStripColor::fromWheel(i + frame));
+    report("fromWheel, per LED", start, BENCHMARK_FRAMES, BENCHMARK_LED_COUNT);
+
+    // Batch wheel fill
+    start = BenchmarkClock::now();
+    for(uint16_t frame = 0; frame < BENCHMARK_FRAMES; frame++)
+        adapter.setRangeLedColorsFromWheel(0, BENCHMARK_LED_COUNT, frame, LED_STRIP_COLOR_WHEEL_STEP);
+    report("setRangeLedColorsFromWheel, batch", start, BENCHMARK_FRAMES, BENCHMARK_LED_COUNT);
+}
+
+/**
+ * Profile the blocking animator on a simulated LED strip.
+ */
+static void benchmarkAnimator() {
+    LedStripSimulated strip(BENCHMARK_LED_COUNT);
+    strip.init();
+    BenchmarkClock::time_point start;
+    uint32_t frames;
+
+    // Rainbow animation
+    frames = strip.getSimulatedAdapter()->getFrameCount();
+    start = BenchmarkClock::now();
+    LedStripAnimator::rainbow(&strip);
+    report("LedStripAnimator::rainbow", start, strip.getSimulatedAdapter()->getFrameCount() - frames,
+           BENCHMARK_LED_COUNT);
+
+    // Fitted rainbow animation
+    frames = strip.getSimulatedAdapter()->getFrameCount();
+    start = BenchmarkClock::now();
+    LedStripAnimator::rainbowFit(&strip);
+    report("LedStripAnimator::rainbowFit", start, strip.getSimulatedAdapter()->getFrameCount() - frames,
+           BENCHMARK_LED_COUNT);
+
+    // Fade animation
+    frames = strip.getSimulatedAdapter()->getFrameCount();
+    start = BenchmarkClock::now();
+    LedStripAnimator::fadeIn(&strip, LedStripColor(255, 127, 0));
+    report("LedStripAnimator::fadeIn", start, strip.getSimulatedAdapter()->getFrameCount() - frames,
+           BENCHMARK_LED_COUNT);
+}
+
+/**
+ * Measure the SPI bit encoding of WS2812 frames, with three and four SPI bits per data bit.
+ */
+static void benchmarkWs2812Encode() {
+    const uint32_t size = (uint32_t) BENCHMARK_LED_COUNT * LedStripPixelWS2812::BYTES_PER_PIXEL;
+    uint8_t* pixels = new uint8_t[size];
+    uint8_t* encoded = new uint8_t[size * 4];
+    for(uint32_t i = 0; i < size; i++)
+        pixels[i] = (uint8_t) i;
+    BenchmarkClock::time_point start;
+
+    // Three SPI bits per data bit
+    start = BenchmarkClock::now();
+    for(uint16_t frame = 0; frame < BENCHMARK_FRAMES; frame++)
+        LedStripAdapterWS2812::encodeSpiBits(pixels, size, 3, encoded);
+    report("WS2812 encodeSpiBits, 3 bits", start, BENCHMARK_FRAMES, BENCHMARK_LED_COUNT);
+
+    // Four SPI bits per data bit
+    start = BenchmarkClock::now();
+    for(uint16_t frame = 0; frame < BENCHMARK_FRAMES; frame++)
+        LedStripAdapterWS2812::encodeSpiBits(pixels, size, 4, encoded);
+    report("WS2812 encodeSpiBits, 4 bits", start, BENCHMARK_FRAMES, BENCHMARK_LED_COUNT);
+
+    delete[] pixels;
+    delete[] encoded;
+}
+
+/**
+ * Measure the transmit throughput of the LPD8806 and APA102 output paths.
+ * The host simulates the port registers in software, so the software SPI numbers are only comparable with each other.
+ */
+static void benchmarkTransmit() {
+    const uint16_t frames = 200;
+
+    // Software SPI on arbitrary pins
+    LPD8806 bitbang(BENCHMARK_LED_COUNT, 2, 3);
+    bitbang.begin();
+    printf("%-40s %10lu bytes/s\n", "LPD8806::show (software SPI)", (unsigned long) bitbang.benchmark(frames));
+
+    // Hardware SPI
+    LPD8806 hardware(BENCHMARK_LED_COUNT);
+    hardware.begin();
+    printf("%-40s %10lu bytes/s\n", "LPD8806::show (hardware SPI)", (unsigned long) hardware.benchmark(frames));
+
+    // Hardware SPI with temporal dithering, which renders every frame from a dithered copy
+    LedStripAdapterLPD8806 dithered(BENCHMARK_LED_COUNT, (uint32_t) LPD8806_SPI_CLOCK_DEFAULT);
+    dithered.init();
+    dithered.setDithering(true);
+    dithered.setRangeLedColors(0, BENCHMARK_LED_COUNT, LedStripColor(3, 5, 7));
+    BenchmarkClock::time_point ditherStart = BenchmarkClock::now();
+    for(uint16_t frame = 0; frame < frames; frame++)
+        dithered.render();
+    double ditherSeconds = std::chrono::duration<double>(BenchmarkClock::now() - ditherStart).count();
+    uint32_t ditherFrameSize = BENCHMARK_LED_COUNT * LedStripPixelLPD8806::BYTES_PER_PIXEL + (BENCHMARK_LED_COUNT + 31) / 32;
+    printf("%-40s %10lu bytes/s\n", "LPD8806 render, dithered (hardware SPI)",
+           (unsigned long) (ditherFrameSize * (double) frames / ditherSeconds));
+
+    // APA102 on arbitrary pins and on the hardware SPI pins
+    LedStripAdapterAPA102 apa102Bitbang(BENCHMARK_LED_COUNT, 2, 3);
+    LedStripAdapterAPA102 apa102Hardware(BENCHMARK_LED_COUNT, (uint32_t) APA102_SPI_CLOCK_DEFAULT);
+    LedStripAdapterAPA102* apa102Adapters[] = {&apa102Bitbang, &apa102Hardware};
+    const char* apa102Names[] = {"APA102 render (software SPI)", "APA102 render (hardware SPI)"};
+    for(uint8_t i = 0; i < 2; i++) {
+        apa102Adapters[i]->init();
+        BenchmarkClock::time_point start = BenchmarkClock::now();
+        for(uint16_t frame = 0; frame < frames; frame++) {
+            apa102Adapters[i]->invalidate();
+            apa102Adapters[i]->render();
+        }
+        double seconds = std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+        uint32_t frameSize = LedStripPixelAPA102::START_FRAME_SIZE + BENCHMARK_LED_COUNT * LedStripPixelAPA102::BYTES_PER_PIXEL +
+                             LedStripPixelAPA102::getEndFrameSize(BENCHMARK_LED_COUNT);
+        printf("%-40s %10lu bytes/s\n", apa102Names[i], (unsigned long) (frameSize * (double) frames / seconds));
+    }
+}
+
+/**
+ * Compare rendering four bit-banged LPD8806 strips one after another against rendering them as a group.
+ * The strips are wired to the same port, so the group bit-bangs them in parallel.
+ */
+static void benchmarkGroup() {
+    const uint16_t stripLedCount = BENCHMARK_LED_COUNT / 4;
+    const uint16_t frames = 200;
+    LedStripLPD8806 strip0(stripLedCount, 8, 12);
+    LedStripLPD8806 strip1(stripLedCount, 9, 12);
+    LedStripLPD8806 strip2(stripLedCount, 10, 12);
+    LedStripLPD8806 strip3(stripLedCount, 11, 12);
+    LedStripLPD8806* strips[] = {&strip0, &strip1, &strip2, &strip3};
+    LedStripGroup group(4);
+    for(uint8_t i = 0; i < 4; i++)
+        group.addStrip(strips[i]);
+    group.init(false);
+    BenchmarkClock::time_point start;
+
+    // Render the strips one by one
+    start = BenchmarkClock::now();
+    for(uint16_t frame = 0; frame < frames; frame++) {
+        for(uint8_t i = 0; i < 4; i++) {
+            strips[i]->getAdapter()->invalidate();
+            strips[i]->render();
+        }
+    }
+    report("4 strips, rendered one by one", start, frames, BENCHMARK_LED_COUNT);
+
+    // Render the strips as a group
+    start = BenchmarkClock::now();
+    for(uint16_t frame = 0; frame < frames; frame++) {
+        group.getAdapter()->invalidate();
+        for(uint8_t i = 0; i < 4; i++)
+            strips[i]->getAdapter()->invalidate();
+        group.render();
+    }
+    report("4 strips, rendered as group", start, frames, BENCHMARK_LED_COUNT);
+}
+
+int main() {
+    printf("LED strip driver host benchmark, %u LEDs\n\n", BENCHMARK_LED_COUNT);
+    benchmarkAdapterWrites();
+    benchmarkWheel();
+    benchmarkAnimator();
+    benchmarkWs2812Encode();
+    benchmarkTransmit();
+    benchmarkGroup();
+    return 0;
+}
\ No newline at end of file
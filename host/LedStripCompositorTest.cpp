@@ -0,0 +1,157 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+/**
+ * Host tests of the layer blend math and the asynchronous render of the compositor.
+ * Two layers are composited on a simulated strip, and the result is compared with known values for each blend mode.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+
+#include "LedStripDriver.h"
+#include "LedStripTest.h"
+
+/**
+ * Number of LEDs of the strips, one for each channel value.
+ */
+const uint16_t TEST_LED_COUNT = 256;
+
+/**
+ * Composite a layer over a base layer, and check the color of the first LED.
+ *
+ * @param blendMode Blend mode of the top layer.
+ * @param opacity Opacity of the top layer.
+ * @param below Color of the base layer.
+ * @param color Color of the top layer.
+ * @param expected Expected composited color.
+ */
+static void checkBlend(uint8_t blendMode, uint8_t opacity, LedStripColor below, LedStripColor color,
+                       LedStripColor expected) {
+    LedStripSimulated strip(1);
+    LedStripLayer base(1, LED_STRIP_LAYER_BLEND_NORMAL);
+    LedStripLayer top(1, blendMode);
+    LedStripCompositor compositor(&strip, 2);
+    compositor.addLayer(&base);
+    compositor.addLayer(&top);
+
+    // Composite the layers
+    base.setLedColor(0, below);
+    top.setLedColor(0, color);
+    top.setOpacity(opacity);
+    compositor.compose();
+
+    TEST_CHECK_EQUAL(strip.getLedColor(0).getCombinedChannels(), expected.getCombinedChannels());
+}
+
+/**
+ * Check each blend mode with an opaque layer.
+ */
+static void testBlendModes() {
+    LedStripColor below(200, 100, 50);
+    LedStripColor color(100, 200, 0);
+
+    // Normal replaces, add saturates, multiply darkens and screen lightens
+    checkBlend(LED_STRIP_LAYER_BLEND_NORMAL, 255, below, color, LedStripColor(100, 200, 0));
+    checkBlend(LED_STRIP_LAYER_BLEND_ADD, 255, below, color, LedStripColor(255, 255, 50));
+    checkBlend(LED_STRIP_LAYER_BLEND_MULTIPLY, 255, below, color, LedStripColor(78, 78, 0));
+    checkBlend(LED_STRIP_LAYER_BLEND_SCREEN, 255, below, color, LedStripColor(222, 222, 50));
+
+    // White and black are the identities of multiply and screen
+    checkBlend(LED_STRIP_LAYER_BLEND_MULTIPLY, 255, below, LedStripColor::white(), below);
+    checkBlend(LED_STRIP_LAYER_BLEND_SCREEN, 255, below, LedStripColor::black(), below);
+}
+
+/**
+ * Check the mix with the color below by the alpha channel and the layer opacity.
+ */
+static void testBlendAlpha() {
+    LedStripColor below(200, 100, 50);
+
+    // Half alpha or half opacity mixes halfway, rounded
+    checkBlend(LED_STRIP_LAYER_BLEND_NORMAL, 255, below, LedStripColor(100, 200, 0, 128), LedStripColor(150, 150, 25));
+    checkBlend(LED_STRIP_LAYER_BLEND_NORMAL, 128, below, LedStripColor(100, 200, 0), LedStripColor(150, 150, 25));
+    checkBlend(LED_STRIP_LAYER_BLEND_ADD, 128, below, LedStripColor(100, 200, 0), LedStripColor(228, 178, 50));
+
+    // Transparent or invisible layers leave the color below
+    checkBlend(LED_STRIP_LAYER_BLEND_NORMAL, 255, below, LedStripColor(100, 200, 0, 0), below);
+    checkBlend(LED_STRIP_LAYER_BLEND_SCREEN, 0, below, LedStripColor(100, 200, 0), below);
+}
+
+/**
+ * Check the multiply blend of every pair of channel values against the exactly rounded product.
+ */
+static void testMultiplyChannel() {
+    LedStripSimulated strip(TEST_LED_COUNT);
+    LedStripLayer base(TEST_LED_COUNT, LED_STRIP_LAYER_BLEND_NORMAL);
+    LedStripLayer top(TEST_LED_COUNT, LED_STRIP_LAYER_BLEND_MULTIPLY);
+    LedStripCompositor compositor(&strip, 2);
+    compositor.addLayer(&base);
+    compositor.addLayer(&top);
+
+    // Give each LED of the base layer its own value
+    for(uint16_t a = 0; a < TEST_LED_COUNT; a++)
+        base.setLedColor(a, (uint8_t) a, (uint8_t) a, (uint8_t) a);
+
+    for(uint16_t b = 0; b < TEST_LED_COUNT; b++) {
+        top.setAllLedColors((uint8_t) b, (uint8_t) b, (uint8_t) b);
+        compositor.compose();
+
+        for(uint16_t a = 0; a < TEST_LED_COUNT; a++)
+            TEST_CHECK_EQUAL(strip.getLedColor(a).getRed(), (a * b * 2 + 255) / 510);
+    }
+}
+
+/**
+ * Check that an asynchronous render is skipped while the previous frame is still being transferred, and that the
+ * skipped change is rendered on the next call.
+ */
+static void testRenderAsyncBusy() {
+    LedStripLPD8806 strip(1, (uint32_t) LPD8806_SPI_CLOCK_DEFAULT);
+    strip.init(false);
+    LedStripLayer base(1, LED_STRIP_LAYER_BLEND_NORMAL);
+    LedStripCompositor compositor(&strip, 1);
+    compositor.addLayer(&base);
+
+    // Start transferring the first frame
+    base.setLedColor(0, 10, 20, 30);
+    TEST_CHECK(compositor.renderAsync());
+    TEST_CHECK(!strip.isRenderComplete());
+
+    // The strip must not be touched until the transfer has completed
+    base.setLedColor(0, 40, 50, 60);
+    TEST_CHECK(!compositor.renderAsync());
+    TEST_CHECK_EQUAL(strip.getLedColor(0).getRed(), 10);
+    while(!strip.isRenderComplete() && SPI.runInterrupt());
+
+    // The change is composed on the next call
+    TEST_CHECK(compositor.renderAsync());
+    TEST_CHECK_EQUAL(strip.getLedColor(0).getRed(), 40);
+    while(!strip.isRenderComplete() && SPI.runInterrupt());
+}
+
+int main() {
+    testBlendModes();
+    testBlendAlpha();
+    testMultiplyChannel();
+    testRenderAsyncBusy();
+    return testResult("LedStripCompositorTest");
+}
\ No newline at end of file
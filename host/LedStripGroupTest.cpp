@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+/**
+ * Host tests of LED strip groups.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+
+#include "LedStripDriver.h"
+#include "LedStripTest.h"
+
+/**
+ * Number of LEDs of each strip in the group.
+ */
+const uint16_t TEST_STRIP_LED_COUNT = 8;
+
+/**
+ * Check that the group only counts LEDs that changed on its strips, so repeated frames leave it clean.
+ */
+static void testDirtyCount() {
+    LedStripSimulated first(TEST_STRIP_LED_COUNT);
+    LedStripSimulated second(TEST_STRIP_LED_COUNT);
+    LedStripGroup group(2);
+    group.addStrip(&first);
+    group.addStrip(&second);
+    group.init(true);
+    LedStripAdapterBase* adapter = group.getAdapter();
+    TEST_CHECK(!group.isDirty());
+
+    // Write a frame spanning both strips, of which one LED is already black
+    LedStripColor colors[TEST_STRIP_LED_COUNT * 2];
+    for(uint16_t i = 0; i < TEST_STRIP_LED_COUNT * 2; i++)
+        colors[i] = LedStripColor((uint8_t) i, 0, 0);
+    group.setLedColors(0, colors, TEST_STRIP_LED_COUNT * 2);
+    TEST_CHECK_EQUAL(adapter->getDirtyLedCount(), TEST_STRIP_LED_COUNT * 2 - 1);
+    group.render();
+    TEST_CHECK_EQUAL(adapter->getRenderedLedCount(), TEST_STRIP_LED_COUNT * 2 - 1);
+
+    // Writing the same frame, LED or range again changes nothing
+    group.setLedColors(0, colors, TEST_STRIP_LED_COUNT * 2);
+    group.setLedColor(3, colors[3]);
+    group.setLedColor(TEST_STRIP_LED_COUNT, colors[TEST_STRIP_LED_COUNT].getRed(), 0, 0);
+    group.setRangeLedColors(0, 1, LedStripColor::black());
+    TEST_CHECK(!group.isDirty());
+    TEST_CHECK_EQUAL(adapter->getDirtyLedCount(), 0);
+
+    // A single change on the second strip marks only that LED
+    group.setLedColor(TEST_STRIP_LED_COUNT + 2, LedStripColor::white());
+    TEST_CHECK_EQUAL(adapter->getDirtyLedCount(), 1);
+    TEST_CHECK_EQUAL(adapter->getDirtyFromLedIndex(), TEST_STRIP_LED_COUNT + 2);
+    TEST_CHECK_EQUAL(adapter->getDirtyToLedIndex(), TEST_STRIP_LED_COUNT + 3);
+    group.render();
+}
+
+/**
+ * Check that spans running past the end of the group are clipped, even if their end overflows.
+ */
+static void testSpanOverflow() {
+    LedStripSimulated first(TEST_STRIP_LED_COUNT);
+    LedStripSimulated second(TEST_STRIP_LED_COUNT);
+    LedStripGroup group(2);
+    group.addStrip(&first);
+    group.addStrip(&second);
+    group.init(true);
+    LedStripAdapterBase* adapter = group.getAdapter();
+
+    // The end of this span wraps around to before its start
+    uint32_t values[4] = {0xFF000000, 0xFF000000, 0xFF000000, 0xFF000000};
+    group.setLedColorsCombinedChannels(TEST_STRIP_LED_COUNT * 2 - 2, values, 0xFFFF);
+    TEST_CHECK_EQUAL(adapter->getDirtyLedCount(), 2);
+    TEST_CHECK_EQUAL(adapter->getDirtyFromLedIndex(), TEST_STRIP_LED_COUNT * 2 - 2);
+    TEST_CHECK_EQUAL(adapter->getDirtyToLedIndex(), TEST_STRIP_LED_COUNT * 2);
+    TEST_CHECK_EQUAL(second.getLedColor(TEST_STRIP_LED_COUNT - 1).getRed(), 255);
+
+    // Spans starting past the end are ignored
+    group.render();
+    group.setLedColorsCombinedChannels(TEST_STRIP_LED_COUNT * 2, values, 4);
+    TEST_CHECK(!group.isDirty());
+}
+
+int main() {
+    testDirtyCount();
+    testSpanOverflow();
+    return testResult("LedStripGroupTest");
+}
\ No newline at end of file
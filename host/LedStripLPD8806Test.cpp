@@ -0,0 +1,280 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+/**
+ * Host tests of the LPD8806 strip helper.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+
+#include <string.h>
+
+#include "LedStripDriver.h"
+#include "LedStripTest.h"
+
+/**
+ * Number of LEDs of the tested strips, spanning two latch bytes.
+ */
+const uint16_t TEST_LED_COUNT = 40;
+
+/**
+ * Size of the frame sent to the tested strips, the pixels followed by the latch bytes.
+ */
+const uint16_t TEST_FRAME_SIZE = TEST_LED_COUNT * 3 + (TEST_LED_COUNT + 31) / 32;
+
+/**
+ * Fill a strip with a pattern that differs for each channel.
+ *
+ * @param strip LPD8806 strip.
+ * @param offset Offset of the pattern, to tell frames apart.
+ */
+static void fillPattern(LPD8806* strip, uint8_t offset) {
+    for(uint16_t i = 0; i < strip->numPixels(); i++)
+        strip->setPixelColor(i, (uint8_t) (i + offset), (uint8_t) (i * 2 + offset), (uint8_t) (127 - i - offset));
+}
+
+/**
+ * Check that a background show() streams the same bytes as a blocking one, and releases the bus afterwards.
+ */
+static void testShowAsync() {
+    LPD8806 strip(TEST_LED_COUNT);
+    strip.begin();
+    fillPattern(&strip, 3);
+
+    // Capture the blocking frame
+    uint8_t expected[TEST_FRAME_SIZE + 1];
+    SPI.setCapture(expected, sizeof(expected));
+    strip.show();
+    TEST_CHECK_EQUAL(SPI.getCaptureLength(), TEST_FRAME_SIZE);
+
+    // Capture the background frame, one simulated interrupt at a time
+    uint8_t actual[TEST_FRAME_SIZE + 1];
+    SPI.setCapture(actual, sizeof(actual));
+    strip.showAsync();
+    TEST_CHECK(!strip.isShowComplete());
+    TEST_CHECK_EQUAL(SPI.getCaptureLength(), 1);
+    uint32_t interrupts = 0;
+    while(!strip.isShowComplete() && SPI.runInterrupt())
+        interrupts++;
+    SPI.setCapture(NULL, 0);
+
+    // The frames must be identical, with one interrupt per byte and the transaction ended
+    TEST_CHECK(strip.isShowComplete());
+    TEST_CHECK_EQUAL(interrupts, TEST_FRAME_SIZE);
+    TEST_CHECK(memcmp(actual, expected, TEST_FRAME_SIZE) == 0);
+    TEST_CHECK_EQUAL(SPI.getClock(), 0);
+}
+
+/**
+ * Present a frame, and capture it as it is sent in the background.
+ * The new drawing buffer is cleared right after presenting, which must not affect the frame being sent.
+ *
+ * @param strip Double buffered LPD8806 strip.
+ * @param keepContents True to copy the presented frame into the new drawing buffer.
+ * @param drawn Buffer to copy the new drawing buffer into right after presenting, before it is cleared.
+ * @param capture Capture buffer, of TEST_FRAME_SIZE bytes.
+ */
+static void presentAndCapture(LPD8806* strip, bool keepContents, uint8_t* drawn, uint8_t* capture) {
+    SPI.setCapture(capture, TEST_FRAME_SIZE);
+    strip->present(keepContents);
+    memcpy(drawn, strip->getPixels(), TEST_FRAME_SIZE);
+    memset(strip->getPixels(), 0x80, TEST_LED_COUNT * 3);
+    while(!strip->isShowComplete() && SPI.runInterrupt());
+    TEST_CHECK_EQUAL(SPI.getCaptureLength(), TEST_FRAME_SIZE);
+    SPI.setCapture(NULL, 0);
+}
+
+/**
+ * Check that present() alternates between the buffers, and starts the new drawing buffer off as a copy of the presented
+ * frame only when asked to.
+ */
+static void testPresent() {
+    LPD8806 strip(TEST_LED_COUNT);
+    strip.begin();
+    TEST_CHECK(strip.setDoubleBuffer(true));
+    uint8_t* first = strip.getPixels();
+    uint8_t frame[TEST_FRAME_SIZE], previousFrame[TEST_FRAME_SIZE], drawn[TEST_FRAME_SIZE], capture[TEST_FRAME_SIZE];
+
+    // Keeping the contents, the new drawing buffer is the other one, holding a copy of the presented frame
+    fillPattern(&strip, 5);
+    memcpy(frame, strip.getPixels(), TEST_FRAME_SIZE);
+    presentAndCapture(&strip, true, drawn, capture);
+    uint8_t* second = strip.getPixels();
+    TEST_CHECK(second != first);
+    TEST_CHECK(memcmp(capture, frame, TEST_FRAME_SIZE) == 0);
+    TEST_CHECK(memcmp(drawn, frame, TEST_FRAME_SIZE) == 0);
+
+    // The next present swaps back
+    fillPattern(&strip, 9);
+    memcpy(previousFrame, strip.getPixels(), TEST_FRAME_SIZE);
+    presentAndCapture(&strip, true, drawn, capture);
+    TEST_CHECK(strip.getPixels() == first);
+    TEST_CHECK(memcmp(capture, previousFrame, TEST_FRAME_SIZE) == 0);
+    TEST_CHECK(memcmp(drawn, previousFrame, TEST_FRAME_SIZE) == 0);
+
+    // Skipping the copy, the new drawing buffer still holds the frame before the presented one
+    fillPattern(&strip, 11);
+    memcpy(frame, strip.getPixels(), TEST_FRAME_SIZE);
+    presentAndCapture(&strip, false, drawn, capture);
+    TEST_CHECK(strip.getPixels() == second);
+    TEST_CHECK(memcmp(capture, frame, TEST_FRAME_SIZE) == 0);
+    TEST_CHECK(memcmp(drawn, previousFrame, TEST_FRAME_SIZE) == 0);
+
+    // The latch bytes of both buffers must stay zero
+    TEST_CHECK_EQUAL(first[TEST_FRAME_SIZE - 1], 0);
+    TEST_CHECK_EQUAL(second[TEST_FRAME_SIZE - 1], 0);
+}
+
+/**
+ * Check that an LPD8806 adapter that skips the copy renders every present, even if the frame didn't change.
+ */
+static void testPresentWithoutCopy() {
+    LedStripAdapterLPD8806 adapter(TEST_LED_COUNT, (uint32_t) LPD8806_SPI_CLOCK_DEFAULT);
+    adapter.init();
+    TEST_CHECK(adapter.setDoubleBuffered(true, false));
+    uint8_t capture[TEST_FRAME_SIZE];
+    for(uint8_t frame = 0; frame < 3; frame++) {
+        adapter.setRangeLedColors(0, TEST_LED_COUNT, 10, 20, 30);
+        SPI.setCapture(capture, TEST_FRAME_SIZE);
+        adapter.present();
+        while(!adapter.isRenderComplete() && SPI.runInterrupt());
+        TEST_CHECK_EQUAL(SPI.getCaptureLength(), TEST_FRAME_SIZE);
+        TEST_CHECK_EQUAL(capture[LedStripPixelLPD8806::RED_INDEX], LedStripPixelLPD8806::encodeChannel(10));
+        SPI.setCapture(NULL, 0);
+    }
+}
+
+/**
+ * Compute the expected scaled and dithered frame: each channel is rounded up when its dither bit is set and the pixel
+ * is dithered on this frame, and then scaled. The latch bytes stay zero.
+ *
+ * @param pixels Pixel buffer of the strip.
+ * @param bits Dither bits, a nibble per pixel.
+ * @param scale Output scale.
+ * @param frame Frame number, the dither phase alternates per frame and per pixel.
+ * @param expected Buffer for the expected frame, of TEST_FRAME_SIZE bytes.
+ */
+static void expectedScaledFrame(const uint8_t* pixels, const uint8_t* bits, uint8_t scale, uint8_t frame,
+                                uint8_t* expected) {
+    memset(expected, 0, TEST_FRAME_SIZE);
+    for(uint16_t i = 0; i < TEST_LED_COUNT; i++) {
+        uint8_t dither = ((i + frame) & 1) ? (uint8_t) (bits[i / 2] >> ((i & 1) * 4)) : 0;
+        for(uint8_t c = 0; c < 3; c++) {
+            uint8_t value = pixels[i * 3 + c] & 0x7F;
+            if((dither & (1 << c)) && value < 0x7F)
+                value++;
+            expected[i * 3 + c] = (uint8_t) ((value * (scale + 1)) >> 8) | 0x80;
+        }
+    }
+}
+
+/**
+ * Check that scaled and dithered frames are sent as computed, blocking and in the background, while the pixel buffer
+ * keeps the drawn colors.
+ */
+static void testScaledShow() {
+    LPD8806 strip(TEST_LED_COUNT);
+    strip.begin();
+    fillPattern(&strip, 0);
+    uint8_t pixels[TEST_FRAME_SIZE];
+    memcpy(pixels, strip.getPixels(), TEST_FRAME_SIZE);
+
+    // Set a different dither pattern for each pixel, and scale the output
+    uint8_t bits[(TEST_LED_COUNT + 1) / 2];
+    for(uint16_t i = 0; i < sizeof(bits); i++)
+        bits[i] = (uint8_t) (i * 37 + 0x5F);
+    strip.setDither(bits);
+    strip.setScale(100);
+
+    uint8_t expected[TEST_FRAME_SIZE];
+    uint8_t capture[TEST_FRAME_SIZE + 1];
+    for(uint8_t frame = 0; frame < 4; frame++) {
+        // Alternate between blocking and background shows
+        SPI.setCapture(capture, sizeof(capture));
+        if(frame & 1) {
+            strip.showAsync();
+            while(!strip.isShowComplete() && SPI.runInterrupt());
+        } else
+            strip.show();
+        TEST_CHECK_EQUAL(SPI.getCaptureLength(), TEST_FRAME_SIZE);
+        SPI.setCapture(NULL, 0);
+
+        expectedScaledFrame(pixels, bits, 100, frame, expected);
+        TEST_CHECK(memcmp(capture, expected, TEST_FRAME_SIZE) == 0);
+    }
+    TEST_CHECK(memcmp(strip.getPixels(), pixels, TEST_FRAME_SIZE) == 0);
+
+    // Without scale or dither the frame goes out as drawn
+    strip.setDither(NULL);
+    strip.setScale(255);
+    SPI.setCapture(capture, sizeof(capture));
+    strip.show();
+    SPI.setCapture(NULL, 0);
+    TEST_CHECK(memcmp(capture, pixels, TEST_FRAME_SIZE) == 0);
+}
+
+/**
+ * Check that a dithered strip in a group keeps alternating its output while nothing changes, since the group renders
+ * its strips only while one of them reports a change.
+ */
+static void testGroupDithering() {
+    LedStripLPD8806 strip(TEST_LED_COUNT, LPD8806_SPI_CLOCK_DEFAULT);
+    LedStripGroup group(1);
+    TEST_CHECK(group.addStrip(&strip));
+    group.init();
+    TEST_CHECK(strip.setDithering(true));
+
+    // Write channel values that lose their low bit in the 7-bit output, then render the change
+    for(uint16_t i = 0; i < TEST_LED_COUNT; i++)
+        group.setLedColor(i, (uint8_t) (i * 6 + 1), (uint8_t) (i * 4 + 3), (uint8_t) (255 - i * 2));
+    group.render();
+
+    // The group stays changed, and its frames alternate
+    uint8_t frames[3][TEST_FRAME_SIZE];
+    for(uint8_t f = 0; f < 3; f++) {
+        TEST_CHECK(group.isDirty());
+        SPI.setCapture(frames[f], TEST_FRAME_SIZE);
+        group.render();
+        TEST_CHECK_EQUAL(SPI.getCaptureLength(), TEST_FRAME_SIZE);
+        SPI.setCapture(NULL, 0);
+    }
+    TEST_CHECK(memcmp(frames[0], frames[1], TEST_FRAME_SIZE) != 0);
+    TEST_CHECK(memcmp(frames[0], frames[2], TEST_FRAME_SIZE) == 0);
+
+    // Without dithering, an unchanged group isn't rendered again
+    TEST_CHECK(strip.setDithering(false));
+    group.render();
+    TEST_CHECK(!group.isDirty());
+    SPI.setCapture(frames[0], TEST_FRAME_SIZE);
+    group.render();
+    TEST_CHECK_EQUAL(SPI.getCaptureLength(), 0);
+    SPI.setCapture(NULL, 0);
+}
+
+int main() {
+    testShowAsync();
+    testPresent();
+    testPresentWithoutCopy();
+    testScaledShow();
+    testGroupDithering();
+    return testResult("LedStripLPD8806Test");
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+/**
+ * Host tests of the native pixel formats, and the round-trip of colors through the adapters using them.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+
+#include "LedStripDriver.h"
+#include "LedStripTest.h"
+
+/**
+ * Number of distinct 7-bit LPD8806 channel values.
+ */
+const uint16_t LPD8806_VALUE_COUNT = LPD8806_COLOR_VALUE_MAX + 1;
+
+/**
+ * Check that every valid 7-bit value round-trips through the LPD8806 pixel encoding.
+ */
+static void testLpd8806Channel() {
+    for(uint16_t value = 0; value < LPD8806_VALUE_COUNT; value++) {
+        uint8_t native = (uint8_t) (LedStripPixelLPD8806::FLAG_BITS | value);
+        TEST_CHECK_EQUAL(LedStripPixelLPD8806::encodeChannel(LedStripPixelLPD8806::decodeChannel(native)), native);
+    }
+
+    // The extremes decode to the full 8-bit range
+    TEST_CHECK_EQUAL(LedStripPixelLPD8806::decodeChannel(LedStripPixelLPD8806::FLAG_BITS), 0);
+    TEST_CHECK_EQUAL(LedStripPixelLPD8806::decodeChannel(LedStripPixelLPD8806::FLAG_BITS | LPD8806_COLOR_VALUE_MAX),
+                     LED_STRIP_COLOR_VALUE_MAX);
+}
+
+/**
+ * Get the decoded 8-bit color of a 7-bit value, with the value shifted differently for each channel.
+ *
+ * @param value 7-bit value.
+ *
+ * @return Color.
+ */
+static LedStripColor decodedColor(uint16_t value) {
+    return LedStripColor(LedStripPixelLPD8806::decodeChannel((uint8_t) (LedStripPixelLPD8806::FLAG_BITS | value)),
+                         LedStripPixelLPD8806::decodeChannel((uint8_t) (LedStripPixelLPD8806::FLAG_BITS |
+                                                                        ((value + 41) % LPD8806_VALUE_COUNT))),
+                         LedStripPixelLPD8806::decodeChannel((uint8_t) (LedStripPixelLPD8806::FLAG_BITS |
+                                                                        ((value + 83) % LPD8806_VALUE_COUNT))));
+}
+
+/**
+ * Check that the decoded color of each LED equals the written one.
+ *
+ * @param adapter LPD8806 adapter, with LPD8806_VALUE_COUNT LEDs.
+ */
+static void checkDecodedColors(LedStripAdapterLPD8806* adapter) {
+    for(uint16_t i = 0; i < LPD8806_VALUE_COUNT; i++)
+        TEST_CHECK_EQUAL(adapter->getLedColor(i).getCombinedChannels(), decodedColor(i).getCombinedChannels());
+}
+
+/**
+ * Check that all decoded 7-bit values round-trip losslessly through the LPD8806 adapter, both when written per LED and
+ * in bulk, and that LEDs beyond the strip read as black.
+ */
+static void testLpd8806AdapterRoundTrip() {
+    LedStripAdapterLPD8806 adapter(LPD8806_VALUE_COUNT, 2, 3);
+
+    // Per LED
+    for(uint16_t i = 0; i < LPD8806_VALUE_COUNT; i++)
+        adapter.setLedColor(i, decodedColor(i));
+    checkDecodedColors(&adapter);
+    for(uint16_t i = 0; i < LPD8806_VALUE_COUNT; i++)
+        TEST_CHECK_EQUAL(adapter.getNativePixels()[i * 3 + LedStripPixelLPD8806::RED_INDEX],
+                         LedStripPixelLPD8806::FLAG_BITS | i);
+
+    // In bulk, after clearing the strip
+    LedStripColor colors[LPD8806_VALUE_COUNT];
+    for(uint16_t i = 0; i < LPD8806_VALUE_COUNT; i++)
+        colors[i] = decodedColor(i);
+    adapter.setRangeLedColors(0, LPD8806_VALUE_COUNT, LedStripColor::black());
+    adapter.setLedColors(0, colors, LPD8806_VALUE_COUNT);
+    checkDecodedColors(&adapter);
+
+    // Beyond the strip
+    TEST_CHECK_EQUAL(adapter.getLedColor(LPD8806_VALUE_COUNT).getCombinedChannels(),
+                     LedStripColor::black().getCombinedChannels());
+    TEST_CHECK_EQUAL(adapter.getLedColorCombinedChannels(0xFFFF), LedStripColor::black().getCombinedChannels());
+}
+
+int main() {
+    testLpd8806Channel();
+    testLpd8806AdapterRoundTrip();
+    return testResult("LedStripPixelTest");
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+/**
+ * Host tests of the SK6812 adapter.
+ * The white channel is checked with and without white extraction, through partial writes and when toggling the
+ * extraction, and the frame sent through the SPI bus is compared with the expected four byte pixels.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+
+#include <string.h>
+
+#include "LedStripDriver.h"
+#include "LedStripTest.h"
+
+/**
+ * Number of LEDs of the test strips.
+ */
+const uint16_t TEST_LED_COUNT = 2;
+
+/**
+ * Check the color and the white channel of an LED.
+ *
+ * @param adapter SK6812 adapter.
+ * @param ledIndex LED index.
+ * @param redChannel Expected red channel.
+ * @param greenChannel Expected green channel.
+ * @param blueChannel Expected blue channel.
+ * @param whiteChannel Expected white channel.
+ */
+static void checkLed(LedStripAdapterSK6812* adapter, uint16_t ledIndex, uint8_t redChannel, uint8_t greenChannel,
+                     uint8_t blueChannel, uint8_t whiteChannel) {
+    LedStripColor color = adapter->getLedColor(ledIndex);
+    TEST_CHECK_EQUAL(color.getRed(), redChannel);
+    TEST_CHECK_EQUAL(color.getGreen(), greenChannel);
+    TEST_CHECK_EQUAL(color.getBlue(), blueChannel);
+    TEST_CHECK_EQUAL(adapter->getLedWhite(ledIndex), whiteChannel);
+}
+
+/**
+ * Check that white extraction moves the shared part of a color to the white channel, and adds it back on read-back.
+ */
+static void testWhiteExtraction() {
+    LedStripAdapterSK6812 adapter(TEST_LED_COUNT);
+    adapter.setWhiteExtraction(true);
+
+    // The smallest channel moves to the white channel, and is merged back in when reading
+    adapter.setLedColor(0, 200, 150, 100);
+    checkLed(&adapter, 0, 200, 150, 100, 100);
+    uint8_t* pixel = adapter.getNativePixels();
+    TEST_CHECK(pixel != NULL);
+    if(pixel == NULL)
+        return;
+    TEST_CHECK_EQUAL(pixel[LedStripPixelSK6812::RED_INDEX], 100);
+    TEST_CHECK_EQUAL(pixel[LedStripPixelSK6812::GREEN_INDEX], 50);
+    TEST_CHECK_EQUAL(pixel[LedStripPixelSK6812::BLUE_INDEX], 0);
+
+    // An explicit white channel is merged too, and the channels are clipped
+    adapter.setLedColorRgbw(1, 10, 20, 30, 40);
+    checkLed(&adapter, 1, 50, 60, 70, 40);
+    adapter.setLedColorRgbw(1, 200, 0, 0, 100);
+    checkLed(&adapter, 1, 255, 100, 100, 100);
+
+    // Changing a single channel extracts the white channel of the whole color again
+    adapter.setLedColor(0, 120);
+    checkLed(&adapter, 0, 120, 150, 100, 100);
+    adapter.setLedColor(0, 50, 60);
+    checkLed(&adapter, 0, 50, 60, 100, 50);
+}
+
+/**
+ * Check that setting only some channels keeps the white channel when white extraction is disabled.
+ */
+static void testPartialWrites() {
+    LedStripAdapterSK6812 adapter(TEST_LED_COUNT);
+    adapter.setLedColorRgbw(0, 10, 20, 30, 40);
+    checkLed(&adapter, 0, 10, 20, 30, 40);
+
+    adapter.setLedColor(0, 100);
+    checkLed(&adapter, 0, 100, 20, 30, 40);
+    adapter.setLedColor(0, 1, 2);
+    checkLed(&adapter, 0, 1, 2, 30, 40);
+
+    // Setting the whole color turns the white emitter off
+    adapter.setLedColor(0, 1, 2, 3);
+    checkLed(&adapter, 0, 1, 2, 3, 0);
+}
+
+/**
+ * Check that toggling white extraction encodes the current colors again, so they are read back the same way.
+ */
+static void testToggleExtraction() {
+    LedStripAdapterSK6812 adapter(TEST_LED_COUNT);
+    adapter.setLedColor(0, 200, 150, 100);
+    adapter.setLedColorRgbw(1, 10, 20, 30, 40);
+
+    // Enabling extracts the white channel, an explicit one is added into the color first
+    adapter.setWhiteExtraction(true);
+    checkLed(&adapter, 0, 200, 150, 100, 100);
+    checkLed(&adapter, 1, 50, 60, 70, 50);
+
+    // Disabling moves the white channel back into the colors
+    adapter.setWhiteExtraction(false);
+    checkLed(&adapter, 0, 200, 150, 100, 0);
+    checkLed(&adapter, 1, 50, 60, 70, 0);
+}
+
+/**
+ * Render a frame through the SPI bus, and compare the transferred bytes with the encoded GRBW pixels.
+ */
+static void testRenderSpi() {
+    LedStripAdapterSK6812 adapter(TEST_LED_COUNT);
+    adapter.init();
+    adapter.setLedColorRgbw(0, 0x11, 0x22, 0x33, 0x44);
+    adapter.setLedColorRgbw(1, 0xA5, 0x00, 0xFF, 0x5A);
+
+    // Four bytes per pixel, in GRBW order
+    const uint8_t pixels[] = {
+        0x22, 0x11, 0x33, 0x44,
+        0x00, 0xA5, 0xFF, 0x5A
+    };
+    uint8_t spiBitsPerBit = adapter.getSpiBitsPerBit();
+    uint8_t expected[sizeof(pixels) * 4];
+    LedStripAdapterWS2812::encodeSpiBits(pixels, sizeof(pixels), spiBitsPerBit, expected);
+
+    // Capture the frame, with room to spare to catch extra bytes
+    uint8_t capture[sizeof(pixels) * 4 + 8];
+    SPI.setCapture(capture, sizeof(capture));
+    adapter.render();
+    TEST_CHECK_EQUAL(SPI.getCaptureLength(), sizeof(pixels) * spiBitsPerBit);
+    SPI.setCapture(NULL, 0);
+    TEST_CHECK(memcmp(capture, expected, sizeof(pixels) * spiBitsPerBit) == 0);
+}
+
+int main() {
+    testWhiteExtraction();
+    testPartialWrites();
+    testToggleExtraction();
+    testRenderSpi();
+    return testResult("LedStripSK6812Test");
+}
\ No newline at end of file
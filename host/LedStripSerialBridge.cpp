@@ -0,0 +1,98 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+/**
+ * Host-side serial frame receiver, over a pseudo-terminal.
+ * Runs LedStripSerialReceiver on a simulated LED strip, fed through a pseudo-terminal, so Adalight compatible senders
+ * can be tested on Linux without any hardware. The path of the terminal to send frames to is printed on start, and the
+ * frame counters are reported every second.
+ *
+ * Usage: LedStripSerialBridge [LED count] [frame count to exit after]
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "LedStripDriver.h"
+
+/**
+ * Default number of LEDs on the simulated strip.
+ */
+const uint16_t BRIDGE_LED_COUNT = 60;
+
+int main(int argc, char** argv) {
+    uint16_t ledCount = argc > 1 ? (uint16_t) atoi(argv[1]) : BRIDGE_LED_COUNT;
+    uint32_t frameLimit = argc > 2 ? (uint32_t) strtoul(argv[2], NULL, 0) : 0;
+
+    // Open a pseudo-terminal
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if(master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+        perror("posix_openpt");
+        return 1;
+    }
+
+    // Keep the terminal open, and switch it to raw mode so the frame bytes pass through unchanged
+    int slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+    struct termios settings;
+    if(slave < 0 || tcgetattr(slave, &settings) != 0) {
+        perror(ptsname(master));
+        return 1;
+    }
+    cfmakeraw(&settings);
+    tcsetattr(slave, TCSANOW, &settings);
+    printf("Send frames to %s\n", ptsname(master));
+    fflush(stdout);
+
+    // Set up the strip and receiver
+    LedStripSimulated strip(ledCount);
+    strip.init(true);
+    HostFileStream stream(master);
+    LedStripSerialReceiver receiver(&strip, &stream);
+    receiver.begin();
+
+    // Receive frames, and report the counters every second
+    unsigned long reportTime = millis();
+    while(frameLimit == 0 || receiver.getFrameCount() < frameLimit) {
+        if(!receiver.update() && stream.available() == 0)
+            usleep(500);
+
+        if(millis() - reportTime >= 1000) {
+            printf("%u frames, %u dropped, %u late\n", receiver.getFrameCount(), receiver.getDroppedFrameCount(),
+                   receiver.getLateFrameCount());
+            fflush(stdout);
+            reportTime += 1000;
+        }
+    }
+
+    // Report the final counters and the color of the first LED
+    LedStripColor color = strip.getLedColor(0);
+    printf("%u frames, %u dropped, %u late, first LED %u,%u,%u\n", receiver.getFrameCount(),
+           receiver.getDroppedFrameCount(), receiver.getLateFrameCount(), color.getRed(), color.getGreen(),
+           color.getBlue());
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+/**
+ * Minimal check helpers for the host tests.
+ * Each test program runs its checks, reports every failed one, and exits with a non-zero status if any failed, so it
+ * can be registered with CTest directly.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+
+#ifndef LEDSTRIPDRIVER_HOST_LEDSTRIPTEST_H
+#define LEDSTRIPDRIVER_HOST_LEDSTRIPTEST_H
+
+#include <stdio.h>
+
+/**
+ * Check that a condition holds.
+ */
+#define TEST_CHECK(condition) testCheck((condition), #condition, __FILE__, __LINE__)
+
+/**
+ * Check that a value equals the expected value.
+ */
+#define TEST_CHECK_EQUAL(actual, expected) \
+        testCheckEqual((unsigned long) (actual), (unsigned long) (expected), #actual, __FILE__, __LINE__)
+
+/**
+ * Number of failed checks.
+ */
+static unsigned long testFailureCount = 0;
+
+/**
+ * Report a failed check.
+ *
+ * @param passed True if the check passed.
+ * @param expression Checked expression.
+ * @param file Source file of the check.
+ * @param line Source line of the check.
+ */
+static inline void testCheck(bool passed, const char* expression, const char* file, int line) {
+    if(passed)
+        return;
+    fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+    testFailureCount++;
+}
+
+/**
+ * Report a failed equality check, along with both values.
+ *
+ * @param actual Actual value.
+ * @param expected Expected value.
+ * @param expression Checked expression.
+ * @param file Source file of the check.
+ * @param line Source line of the check.
+ */
+static inline void testCheckEqual(unsigned long actual, unsigned long expected, const char* expression,
+                                  const char* file, int line) {
+    if(actual == expected)
+        return;
+    fprintf(stderr, "%s:%d: check failed: %s is %lu, expected %lu\n", file, line, expression, actual, expected);
+    testFailureCount++;
+}
+
+/**
+ * Report the result of the test program.
+ *
+ * @param name Test program name.
+ *
+ * @return Exit status, zero if all checks passed.
+ */
+static inline int testResult(const char* name) {
+    if(testFailureCount > 0) {
+        printf("%s: %lu checks failed\n", name, testFailureCount);
+        return 1;
+    }
+    printf("%s: all checks passed\n", name);
+    return 0;
+}
+
+#endif // LEDSTRIPDRIVER_HOST_LEDSTRIPTEST_H
\ No newline at end of file
@@ -0,0 +1,301 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+/**
+ * Host-side compiler of LED strip timeline programs.
+ * Compiles a text description of a show into the binary program executed by LedStripTimeline, and reports its size.
+ * The program is written as a PROGMEM array declaration to paste into a sketch, or as raw bytes with --binary.
+ *
+ * Usage: LedStripTimelineCompiler [--binary] <input file> [array name]
+ *
+ * Each line holds one instruction. A # at the start of a line or followed by a blank starts a comment. Colors are
+ * either three channel values or a #rrggbb hex value, durations are in milliseconds:
+ *
+ *   segment <from> <to|end>     Select the LEDs the following instructions apply to.
+ *   fill <color>                Set the selected LEDs to a color at once.
+ *   fade <color> <duration>     Fade the selected LEDs from the last color to a new color.
+ *   wipe <color> <duration>     Wipe a new color over the selected LEDs.
+ *   rainbow <duration>          Cycle a fitted rainbow over the selected LEDs once.
+ *   hold <duration>             Keep the LEDs as they are.
+ *   mark                        Mark the start of a loop, the end of the previous loop or the start of the program
+ *                               if omitted.
+ *   loop <count|forever>        Play the section since the mark the given number of times in total.
+ *   end                         End the program, implied at the end of the file.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "LedStripTimeline.h"
+
+/**
+ * Maximum size of a compiled program.
+ */
+const uint32_t COMPILER_PROGRAM_SIZE_MAX = 0x10000;
+
+/**
+ * Maximum length of an input line.
+ */
+const uint16_t COMPILER_LINE_LENGTH_MAX = 256;
+
+/**
+ * Compiled program.
+ */
+static uint8_t program[COMPILER_PROGRAM_SIZE_MAX];
+
+/**
+ * Size of the compiled program.
+ */
+static uint32_t programSize = 0;
+
+/**
+ * Program offset a loop without a mark jumps back to, right after the previous loop or the start of the program.
+ * The interpreter keeps a single loop counter, so a loop must never jump back over an earlier loop, which would take
+ * over its counter.
+ */
+static uint16_t loopStart = 1;
+
+/**
+ * Input file name and line number, for error reporting.
+ */
+static const char* inputName;
+static uint32_t lineNumber = 0;
+
+/**
+ * Report an error on the current input line, and exit.
+ *
+ * @param message Error message.
+ * @param token Token the error applies to, or NULL.
+ */
+static void fail(const char* message, const char* token) {
+    fprintf(stderr, "%s:%u: %s%s%s\n", inputName, lineNumber, message, token != NULL ? ": " : "",
+            token != NULL ? token : "");
+    exit(1);
+}
+
+/**
+ * Append a byte to the program.
+ *
+ * @param value Byte value.
+ */
+static void emitByte(uint8_t value) {
+    if(programSize >= COMPILER_PROGRAM_SIZE_MAX)
+        fail("program too large", NULL);
+    program[programSize++] = value;
+}
+
+/**
+ * Append a little-endian 16-bit value to the program.
+ *
+ * @param value Value.
+ */
+static void emitWord(uint16_t value) {
+    emitByte((uint8_t) value);
+    emitByte((uint8_t) (value >> 8));
+}
+
+/**
+ * Get the next token of the current line.
+ *
+ * @param required True to fail if there are no tokens left.
+ *
+ * @return Token, or NULL if there are no tokens left.
+ */
+static char* nextToken(bool required) {
+    char* token = strtok(NULL, " \t\r\n");
+    if(token == NULL && required)
+        fail("missing operand", NULL);
+    return token;
+}
+
+/**
+ * Parse a number from the next token of the current line.
+ *
+ * @param max Maximum value.
+ *
+ * @return Value.
+ */
+static uint32_t parseNumber(uint32_t max) {
+    char* token = nextToken(true);
+    char* end;
+    unsigned long value = strtoul(token, &end, 0);
+    if(*end != '\0' || token[0] == '-')
+        fail("invalid number", token);
+    if(value > max)
+        fail("number out of range", token);
+    return (uint32_t) value;
+}
+
+/**
+ * Parse a color from the next tokens of the current line, and append it to the program.
+ */
+static void emitColor() {
+    // Parse a hex color from a single token
+    char* token = nextToken(true);
+    if(token[0] == '#') {
+        char* end;
+        unsigned long value = strtoul(token + 1, &end, 16);
+        if(*end != '\0' || strlen(token) != 7)
+            fail("invalid color", token);
+        emitByte((uint8_t) (value >> 16));
+        emitByte((uint8_t) (value >> 8));
+        emitByte((uint8_t) value);
+        return;
+    }
+
+    // Parse the channel values from three tokens
+    char* end;
+    unsigned long red = strtoul(token, &end, 0);
+    if(*end != '\0' || token[0] == '-' || red > 0xFF)
+        fail("invalid color", token);
+    emitByte((uint8_t) red);
+    emitByte((uint8_t) parseNumber(0xFF));
+    emitByte((uint8_t) parseNumber(0xFF));
+}
+
+/**
+ * Compile a single input line.
+ *
+ * @param line Input line.
+ * @param mark Program offset of the loop mark, 0 if none.
+ *
+ * @return False if the end instruction was compiled, true otherwise.
+ */
+static bool compileLine(char* line, uint16_t* mark) {
+    // Strip comments, a # starting a line or followed by a blank, so it doesn't collide with hex colors
+    char* comment = line + strspn(line, " \t");
+    if(*comment != '#')
+        for(comment = strchr(line, '#'); comment != NULL && strchr(" \t\r\n", comment[1]) == NULL;
+            comment = strchr(comment + 1, '#'));
+    if(comment != NULL)
+        *comment = '\0';
+    char* instruction = strtok(line, " \t\r\n");
+    if(instruction == NULL)
+        return true;
+
+    if(strcmp(instruction, "segment") == 0) {
+        emitByte(LED_STRIP_TIMELINE_OP_SEGMENT);
+        emitWord((uint16_t) parseNumber(LED_STRIP_TIMELINE_SEGMENT_END - 1));
+        char* to = nextToken(true);
+        if(strcmp(to, "end") == 0)
+            emitWord(LED_STRIP_TIMELINE_SEGMENT_END);
+        else {
+            char* end;
+            unsigned long value = strtoul(to, &end, 0);
+            if(*end != '\0' || to[0] == '-' || value >= LED_STRIP_TIMELINE_SEGMENT_END)
+                fail("invalid segment end", to);
+            emitWord((uint16_t) value);
+        }
+    } else if(strcmp(instruction, "fill") == 0) {
+        emitByte(LED_STRIP_TIMELINE_OP_FILL);
+        emitColor();
+    } else if(strcmp(instruction, "fade") == 0 || strcmp(instruction, "wipe") == 0) {
+        emitByte(instruction[0] == 'f' ? LED_STRIP_TIMELINE_OP_FADE : LED_STRIP_TIMELINE_OP_WIPE);
+        emitColor();
+        emitWord((uint16_t) parseNumber(0xFFFF));
+    } else if(strcmp(instruction, "rainbow") == 0 || strcmp(instruction, "hold") == 0) {
+        emitByte(instruction[0] == 'r' ? LED_STRIP_TIMELINE_OP_RAINBOW : LED_STRIP_TIMELINE_OP_HOLD);
+        emitWord((uint16_t) parseNumber(0xFFFF));
+    } else if(strcmp(instruction, "mark") == 0) {
+        // The interpreter keeps a single loop counter, so loops can't be nested
+        if(*mark != 0)
+            fail("nested loops are not supported", NULL);
+        *mark = (uint16_t) programSize;
+    } else if(strcmp(instruction, "loop") == 0) {
+        char* count = nextToken(true);
+        uint8_t passes = 0;
+        if(strcmp(count, "forever") != 0) {
+            char* end;
+            unsigned long value = strtoul(count, &end, 0);
+            if(*end != '\0' || value < 1 || value > 0xFF)
+                fail("invalid loop count", count);
+            passes = (uint8_t) value;
+        }
+        emitByte(LED_STRIP_TIMELINE_OP_LOOP);
+        emitWord(*mark != 0 ? *mark : loopStart);
+        emitByte(passes);
+        *mark = 0;
+        loopStart = (uint16_t) programSize;
+    } else if(strcmp(instruction, "end") == 0) {
+        emitByte(LED_STRIP_TIMELINE_OP_END);
+        return false;
+    } else
+        fail("unknown instruction", instruction);
+
+    // Nothing may follow the operands
+    char* extra = nextToken(false);
+    if(extra != NULL)
+        fail("unexpected operand", extra);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    // Parse the arguments
+    bool binary = argc > 1 && strcmp(argv[1], "--binary") == 0;
+    int arg = binary ? 2 : 1;
+    if(arg >= argc || argc > arg + 2) {
+        fprintf(stderr, "Usage: %s [--binary] <input file> [array name]\n", argv[0]);
+        return 2;
+    }
+    inputName = argv[arg];
+    const char* arrayName = arg + 1 < argc ? argv[arg + 1] : "timelineProgram";
+
+    // Open the input
+    FILE* input = fopen(inputName, "r");
+    if(input == NULL) {
+        perror(inputName);
+        return 1;
+    }
+
+    // Compile each line, and end the program if that wasn't done explicitly
+    char line[COMPILER_LINE_LENGTH_MAX];
+    uint16_t mark = 0;
+    bool open = true;
+    emitByte(LED_STRIP_TIMELINE_VERSION);
+    while(open && fgets(line, sizeof(line), input) != NULL) {
+        lineNumber++;
+        open = compileLine(line, &mark);
+    }
+    fclose(input);
+    if(mark != 0)
+        fail("mark without loop", NULL);
+    if(open)
+        emitByte(LED_STRIP_TIMELINE_OP_END);
+
+    // Write the program
+    if(binary)
+        fwrite(program, 1, programSize, stdout);
+    else {
+        printf("const uint8_t %s[] PROGMEM = {", arrayName);
+        for(uint32_t i = 0; i < programSize; i++)
+            printf("%s0x%02X", i == 0 ? "\n    " : i % 12 == 0 ? ",\n    " : ", ", program[i]);
+        printf("\n};\n");
+    }
+
+    // Report the program size
+    fprintf(stderr, "%s: %u bytes\n", inputName, programSize);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,211 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+/**
+ * Host tests of LED strip timeline programs.
+ * Compiles the sample shows with LedStripTimelineCompiler, checks the programs byte for byte, and plays them on a
+ * simulated LED strip.
+ *
+ * Usage: LedStripTimelineTest <compiler> <sample show> <loop show>
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "LedStripDriver.h"
+#include "LedStripTest.h"
+
+/**
+ * Expected program of the sample show, see LedStripTimelineSample.txt.
+ */
+const uint8_t SAMPLE_PROGRAM[] = {
+    LED_STRIP_TIMELINE_VERSION,
+    LED_STRIP_TIMELINE_OP_SEGMENT, 0x00, 0x00, 0xFF, 0xFF,  // segment 0 end
+    LED_STRIP_TIMELINE_OP_FILL, 0x00, 0x00, 0x00,           // fill 0 0 0
+    LED_STRIP_TIMELINE_OP_FADE, 0xFF, 0x80, 0x00, 0xE8, 0x03, // fade #ff8000 1000, at the mark
+    LED_STRIP_TIMELINE_OP_WIPE, 0x00, 0x00, 0xFF, 0xF4, 0x01, // wipe 0 0 255 500
+    LED_STRIP_TIMELINE_OP_HOLD, 0xFA, 0x00,                 // hold 250
+    LED_STRIP_TIMELINE_OP_LOOP, 0x0A, 0x00, 0x03,           // loop 3
+    LED_STRIP_TIMELINE_OP_SEGMENT, 0x00, 0x00, 0x05, 0x00,  // segment 0 5
+    LED_STRIP_TIMELINE_OP_RAINBOW, 0xD0, 0x07,              // rainbow 2000
+    LED_STRIP_TIMELINE_OP_SEGMENT, 0x05, 0x00, 0xFF, 0xFF,  // segment 5 end
+    LED_STRIP_TIMELINE_OP_FADE, 0xFF, 0xFF, 0xFF, 0x2C, 0x01, // fade 255 255 255 300
+    LED_STRIP_TIMELINE_OP_END
+};
+
+/**
+ * Size of the expected program.
+ */
+const uint16_t SAMPLE_PROGRAM_SIZE = sizeof(SAMPLE_PROGRAM);
+
+/**
+ * Expected program of the loop show, see LedStripTimelineLoops.txt.
+ * The second loop has no mark, and jumps back to right after the first loop rather than to the start of the program.
+ */
+const uint8_t LOOP_PROGRAM[] = {
+    LED_STRIP_TIMELINE_VERSION,
+    LED_STRIP_TIMELINE_OP_FILL, 0xFF, 0x00, 0x00,           // fill 255 0 0
+    LED_STRIP_TIMELINE_OP_HOLD, 0x64, 0x00,                 // hold 100
+    LED_STRIP_TIMELINE_OP_LOOP, 0x01, 0x00, 0x03,           // loop 3
+    LED_STRIP_TIMELINE_OP_FILL, 0x00, 0xFF, 0x00,           // fill 0 255 0
+    LED_STRIP_TIMELINE_OP_HOLD, 0x64, 0x00,                 // hold 100
+    LED_STRIP_TIMELINE_OP_LOOP, 0x0C, 0x00, 0x02,           // loop 2
+    LED_STRIP_TIMELINE_OP_END
+};
+
+/**
+ * Compile a show, and compare the program byte for byte.
+ *
+ * @param compiler Path of the compiler.
+ * @param show Path of the show.
+ * @param expected Expected program.
+ * @param expectedSize Size of the expected program.
+ */
+static void checkCompiler(const char* compiler, const char* show, const uint8_t* expected, size_t expectedSize) {
+    // Compile the show to raw bytes
+    char command[512];
+    snprintf(command, sizeof(command), "\"%s\" --binary \"%s\"", compiler, show);
+    FILE* output = popen(command, "r");
+    TEST_CHECK(output != NULL);
+    if(output == NULL)
+        return;
+    uint8_t program[SAMPLE_PROGRAM_SIZE * 2];
+    size_t size = fread(program, 1, sizeof(program), output);
+    TEST_CHECK_EQUAL(pclose(output), 0);
+
+    // Compare the program byte for byte
+    TEST_CHECK_EQUAL(size, expectedSize);
+    TEST_CHECK(size == expectedSize && memcmp(program, expected, expectedSize) == 0);
+}
+
+/**
+ * Compile the sample shows, and check the programs.
+ *
+ * @param compiler Path of the compiler.
+ * @param sample Path of the sample show.
+ * @param loops Path of the loop show.
+ */
+static void testCompiler(const char* compiler, const char* sample, const char* loops) {
+    TEST_CHECK_EQUAL(SAMPLE_PROGRAM_SIZE, 49);
+    checkCompiler(compiler, sample, SAMPLE_PROGRAM, SAMPLE_PROGRAM_SIZE);
+    checkCompiler(compiler, loops, LOOP_PROGRAM, sizeof(LOOP_PROGRAM));
+}
+
+/**
+ * Check the color of an LED.
+ *
+ * @param strip LED strip.
+ * @param ledIndex LED index.
+ * @param red Expected red channel value.
+ * @param green Expected green channel value.
+ * @param blue Expected blue channel value.
+ */
+static void checkLedColor(LedStripBase* strip, uint16_t ledIndex, uint8_t red, uint8_t green, uint8_t blue) {
+    TEST_CHECK_EQUAL(strip->getLedColor(ledIndex).getCombinedChannels(),
+                     LedStripColor(red, green, blue).getCombinedChannels());
+}
+
+/**
+ * Play the sample program on a simulated strip, and check the colors at points in the show.
+ */
+static void testPlayback() {
+    LedStripSimulated strip(10);
+    strip.init(false);
+    LedStripTimeline timeline(&strip, SAMPLE_PROGRAM, false, 10);
+
+    // Play the show in 10 ms frames, checking the strip at the points of interest
+    const unsigned long start = 1000;
+    unsigned long elapsed = 0;
+    while(!timeline.isFinished() && elapsed < 10000) {
+        timeline.update(start + elapsed);
+        switch(elapsed) {
+            case 500:
+                // Halfway the first fade to orange
+                checkLedColor(&strip, 0, 127, 64, 0);
+                checkLedColor(&strip, 9, 127, 64, 0);
+                break;
+            case 1250:
+                // Halfway the wipe to blue
+                checkLedColor(&strip, 0, 0, 0, 255);
+                checkLedColor(&strip, 9, 255, 128, 0);
+                break;
+            case 2250:
+                // Halfway the fade of the second pass, from blue to orange
+                checkLedColor(&strip, 0, 127, 64, 128);
+                break;
+            case 5250:
+                // The rainbow starts on the first segment after the third pass, the second one is left blue
+                checkLedColor(&strip, 0, 255, 0, 0);
+                checkLedColor(&strip, 9, 0, 0, 255);
+                break;
+            default:
+                break;
+        }
+        elapsed += 10;
+    }
+
+    // The show lasts three passes of 1750 ms, a rainbow of 2000 ms and a fade of 300 ms
+    TEST_CHECK(timeline.isFinished());
+    TEST_CHECK(elapsed >= 7550 && elapsed <= 7570);
+    checkLedColor(&strip, 9, 255, 255, 255);
+}
+
+/**
+ * Play the loop program, which must end after three passes of the first loop and two passes of the second one.
+ */
+static void testLoopPlayback() {
+    LedStripSimulated strip(4);
+    strip.init(false);
+    LedStripTimeline timeline(&strip, LOOP_PROGRAM, false, 10);
+
+    // Count the frames the first LED is red and green
+    const unsigned long start = 1000;
+    unsigned long elapsed = 0;
+    uint16_t redFrames = 0, greenFrames = 0;
+    while(!timeline.isFinished() && elapsed < 10000) {
+        timeline.update(start + elapsed);
+        if(strip.getLedColor(0).getRed() == 255)
+            redFrames++;
+        else if(strip.getLedColor(0).getGreen() == 255)
+            greenFrames++;
+        elapsed += 10;
+    }
+
+    // Each pass holds for 100 ms, so the program takes 500 ms, give or take the frames around the end
+    TEST_CHECK(timeline.isFinished());
+    TEST_CHECK(elapsed >= 490 && elapsed <= 520);
+    TEST_CHECK(redFrames >= 29 && redFrames <= 31);
+    TEST_CHECK(greenFrames >= 19 && greenFrames <= 23);
+}
+
+int main(int argc, char** argv) {
+    if(argc != 4) {
+        fprintf(stderr, "Usage: %s <compiler> <sample show> <loop show>\n", argv[0]);
+        return 2;
+    }
+    testCompiler(argv[1], argv[2], argv[3]);
+    testPlayback();
+    testLoopPlayback();
+    return testResult("LedStripTimelineTest");
+}
\ No newline at end of file
@@ -0,0 +1,202 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+/**
+ * Host tests of the WS2812 adapter output.
+ * The SPI bit encoding is checked against a bit-by-bit reference for every byte value, and the frames sent through the
+ * SPI bus and the data pin are captured and compared with the expected output.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+
+#include <string.h>
+
+#include "LedStripDriver.h"
+#include "LedStripTest.h"
+
+/**
+ * Number of distinct byte values.
+ */
+const uint16_t TEST_VALUE_COUNT = 256;
+
+/**
+ * Number of LEDs of the test strips.
+ */
+const uint16_t TEST_LED_COUNT = 2;
+
+/**
+ * Data pin of the strip driven from a pin.
+ */
+const uint8_t TEST_PIN = 10;
+
+/**
+ * Another pin on the same simulated port, which must be left as it is.
+ */
+const uint8_t TEST_PIN_OTHER = 8;
+
+/**
+ * Native GRB pixel data of the test colors.
+ */
+const uint8_t TEST_PIXELS[] = {
+    0x00, 0xFF, 0x00,
+    0x5A, 0x01, 0xC3
+};
+
+/**
+ * Encode data into SPI bit patterns one bit at a time, as the reference for the table based encoding.
+ * A 0 bit is a single high SPI bit, a 1 bit is high for all but the last SPI bit.
+ *
+ * @param source Data to encode.
+ * @param size Number of bytes of data.
+ * @param spiBitsPerBit Number of SPI bits per data bit.
+ * @param target Buffer for the encoded data, of size times spiBitsPerBit bytes.
+ */
+static void encodeReference(const uint8_t* source, uint32_t size, uint8_t spiBitsPerBit, uint8_t* target) {
+    memset(target, 0, size * spiBitsPerBit);
+    uint32_t spiBit = 0;
+    for(uint32_t i = 0; i < size; i++) {
+        for(uint8_t bit = 0x80; bit; bit >>= 1) {
+            uint8_t highBits = (source[i] & bit) ? spiBitsPerBit - 1 : 1;
+            for(uint8_t k = 0; k < spiBitsPerBit; k++, spiBit++)
+                if(k < highBits)
+                    target[spiBit / 8] |= (uint8_t) (0x80 >> (spiBit % 8));
+        }
+    }
+}
+
+/**
+ * Check the SPI encoding of every byte value against the reference.
+ *
+ * @param spiBitsPerBit Number of SPI bits per data bit.
+ */
+static void checkEncodeSpiBits(uint8_t spiBitsPerBit) {
+    uint8_t source[TEST_VALUE_COUNT];
+    for(uint16_t value = 0; value < TEST_VALUE_COUNT; value++)
+        source[value] = (uint8_t) value;
+
+    // Encode all values at once, so each one is also checked to land at the right offset
+    uint8_t expected[TEST_VALUE_COUNT * 4];
+    uint8_t actual[TEST_VALUE_COUNT * 4];
+    encodeReference(source, TEST_VALUE_COUNT, spiBitsPerBit, expected);
+    TEST_CHECK_EQUAL(LedStripAdapterWS2812::encodeSpiBits(source, TEST_VALUE_COUNT, spiBitsPerBit, actual),
+                     TEST_VALUE_COUNT * spiBitsPerBit);
+    for(uint16_t value = 0; value < TEST_VALUE_COUNT; value++)
+        TEST_CHECK(memcmp(&actual[value * spiBitsPerBit], &expected[value * spiBitsPerBit], spiBitsPerBit) == 0);
+}
+
+/**
+ * Check the SPI encoding with three and four SPI bits per data bit, and that other sizes are refused.
+ */
+static void testEncodeSpiBits() {
+    checkEncodeSpiBits(3);
+    checkEncodeSpiBits(4);
+
+    uint8_t target[8];
+    TEST_CHECK_EQUAL(LedStripAdapterWS2812::encodeSpiBits(TEST_PIXELS, 1, 2, target), 0);
+    TEST_CHECK_EQUAL(LedStripAdapterWS2812::encodeSpiBits(TEST_PIXELS, 1, 5, target), 0);
+}
+
+/**
+ * Set the test colors on an adapter.
+ *
+ * @param adapter WS2812 adapter.
+ */
+static void setTestColors(LedStripAdapterWS2812* adapter) {
+    for(uint16_t i = 0; i < TEST_LED_COUNT; i++) {
+        const uint8_t* pixel = &TEST_PIXELS[i * LedStripPixelWS2812::BYTES_PER_PIXEL];
+        adapter->setLedColor(i, pixel[LedStripPixelWS2812::RED_INDEX], pixel[LedStripPixelWS2812::GREEN_INDEX],
+                             pixel[LedStripPixelWS2812::BLUE_INDEX]);
+    }
+}
+
+/**
+ * Render a frame through the SPI bus with the given encoding, and compare the transferred bytes with the reference.
+ *
+ * @param spiBitsPerBit Number of SPI bits per data bit.
+ */
+static void checkRenderSpi(uint8_t spiBitsPerBit) {
+    LedStripAdapterWS2812 adapter(TEST_LED_COUNT);
+    TEST_CHECK(adapter.setSpiBitsPerBit(spiBitsPerBit));
+    adapter.init();
+    setTestColors(&adapter);
+
+    // Capture the frame, with room to spare to catch extra bytes
+    uint8_t expected[sizeof(TEST_PIXELS) * 4];
+    uint8_t capture[sizeof(TEST_PIXELS) * 4 + 8];
+    encodeReference(TEST_PIXELS, sizeof(TEST_PIXELS), spiBitsPerBit, expected);
+    SPI.setCapture(capture, sizeof(capture));
+    adapter.render();
+    TEST_CHECK_EQUAL(SPI.getCaptureLength(), sizeof(TEST_PIXELS) * spiBitsPerBit);
+    SPI.setCapture(NULL, 0);
+    TEST_CHECK(memcmp(capture, expected, sizeof(TEST_PIXELS) * spiBitsPerBit) == 0);
+}
+
+/**
+ * Check the frames sent through the SPI bus.
+ */
+static void testRenderSpi() {
+    checkRenderSpi(3);
+    checkRenderSpi(4);
+}
+
+/**
+ * Render a frame from the data pin, and compare the captured port writes with the expected sequence.
+ * Each bit raises the line, keeps it high for a 1 bit or lowers it for a 0 bit, and then lowers it.
+ */
+static void testTransmitPin() {
+    LedStripAdapterWS2812 adapter(TEST_LED_COUNT, TEST_PIN);
+    adapter.init();
+    setTestColors(&adapter);
+
+    // Set another pin on the port high, the output must not change it
+    HostPortRegister* port = portOutputRegister(digitalPinToPort(TEST_PIN));
+    *port = digitalPinToBitMask(TEST_PIN_OTHER);
+    uint8_t hi = digitalPinToBitMask(TEST_PIN_OTHER) | digitalPinToBitMask(TEST_PIN);
+    uint8_t lo = digitalPinToBitMask(TEST_PIN_OTHER);
+
+    // Capture the port writes, with room to spare to catch extra writes
+    uint8_t capture[sizeof(TEST_PIXELS) * 8 * 3 + 8];
+    hostSetPortCapture(digitalPinToPort(TEST_PIN), capture, sizeof(capture));
+    adapter.render();
+    TEST_CHECK_EQUAL(hostGetPortCaptureLength(), sizeof(TEST_PIXELS) * 8 * 3);
+    hostSetPortCapture(0, NULL, 0);
+
+    // Compare the sequence bit by bit
+    uint8_t* ptr = capture;
+    for(uint32_t i = 0; i < sizeof(TEST_PIXELS); i++) {
+        for(uint8_t bit = 0x80; bit; bit >>= 1) {
+            TEST_CHECK_EQUAL(*ptr++, hi);
+            TEST_CHECK_EQUAL(*ptr++, (TEST_PIXELS[i] & bit) ? hi : lo);
+            TEST_CHECK_EQUAL(*ptr++, lo);
+        }
+    }
+
+    // The line must idle low
+    TEST_CHECK_EQUAL(*port, lo);
+}
+
+int main() {
+    testEncodeSpiBits();
+    testRenderSpi();
+    testTransmitPin();
+    return testResult("LedStripWS2812Test");
+}
\ No newline at end of file
@@ -0,0 +1,200 @@
+/******************************************************************************
+ * Copyright (c) UniversalLedStripDriver 2016. All rights reserved.           *
+ *                                                                            *
+ * @author Tim Visee                                                          *
+ * @website http://timvisee.com/                                              *
+ *                                                                            *
+ * Open Source != No Copyright                                                *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included    *
+ * in all copies or substantial portions of the Software.                     *
+ *                                                                            *
+ * You should have received a copy of The MIT License (MIT) along with this   *
+ * program. If not, see <http://opensource.org/licenses/MIT/>.                *
+ ******************************************************************************/
+
+/**
+ * Minimal Arduino SPI library shim for host builds.
+ * Transferred bytes are counted, and optionally captured into a caller supplied buffer.
+ *
+ * @author Tim Visee
+ * @website http://timvisee.com/
+ */
+
+#ifndef LEDSTRIPDRIVER_HOST_SPI_H
+#define LEDSTRIPDRIVER_HOST_SPI_H
+
+#include "Arduino.h"
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x04
+#define SPI_MODE2 0x08
+#define SPI_MODE3 0x0C
+
+#define SPI_CLOCK_DIV2 0x04
+#define SPI_CLOCK_DIV4 0x00
+#define SPI_CLOCK_DIV8 0x05
+#define SPI_CLOCK_DIV16 0x01
+#define SPI_CLOCK_DIV32 0x06
+#define SPI_CLOCK_DIV64 0x02
+#define SPI_CLOCK_DIV128 0x03
+
+#define SPI_HAS_TRANSACTION 1
+
+/**
+ * SPI bus settings, applied by SPIClass::beginTransaction().
+ */
+class SPISettings {
+public:
+    /**
+     * Clock rate in Hz.
+     */
+    uint32_t clock;
+
+    /**
+     * Bit order.
+     */
+    uint8_t bitOrder;
+
+    /**
+     * Data mode.
+     */
+    uint8_t dataMode;
+
+    SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode) :
+            clock(clock), bitOrder(bitOrder), dataMode(dataMode) { }
+
+    SPISettings() : clock(4000000), bitOrder(MSBFIRST), dataMode(SPI_MODE0) { }
+};
+
+class SPIClass {
+private:
+    /**
+     * Total number of transferred bytes.
+     */
+    uint32_t transferCount;
+
+    /**
+     * Capture buffer, or NULL if bytes aren't captured.
+     */
+    uint8_t* capture;
+
+    /**
+     * Size of the capture buffer.
+     */
+    uint32_t captureSize;
+
+    /**
+     * Number of bytes in the capture buffer.
+     */
+    uint32_t captureLength;
+
+    /**
+     * Clock rate of the current transaction in Hz, or 0 if no transaction is active.
+     */
+    uint32_t clock;
+
+    /**
+     * Highest clock rate at which MISO reads back MOSI, or 0 if nothing is connected to MISO.
+     */
+    uint32_t loopbackClock;
+
+    /**
+     * Transfer complete interrupt handler, or NULL if the interrupt is disabled.
+     */
+    void (*interruptHandler)();
+
+    /**
+     * True if a byte issued with transferAsync() is being shifted out.
+     */
+    bool transferPending;
+
+public:
+    SPIClass();
+
+    void begin();
+    void end();
+    void setBitOrder(uint8_t bitOrder);
+    void setDataMode(uint8_t dataMode);
+    void setClockDivider(uint8_t clockDivider);
+    void beginTransaction(SPISettings settings);
+    void endTransaction();
+    uint8_t transfer(uint8_t data);
+
+    /**
+     * Enable the transfer complete interrupt, calling the given handler.
+     * On AVR the handler is the SPI_STC_vect ISR instead.
+     *
+     * @param handler Interrupt handler.
+     */
+    void attachInterrupt(void (*handler)());
+
+    /**
+     * Disable the transfer complete interrupt.
+     */
+    void detachInterrupt();
+
+    /**
+     * Issue a byte without waiting for it, like writing SPDR on AVR.
+     * The transfer completes when the simulated interrupt runs, see runInterrupt().
+     *
+     * @param data Byte to transfer.
+     */
+    void transferAsync(uint8_t data);
+
+    /**
+     * Complete the pending transfer, and run the transfer complete interrupt handler if it's enabled.
+     * Call this repeatedly to simulate the SPI hardware in the background.
+     *
+     * @return True if a transfer was completed, false if none was pending.
+     */
+    bool runInterrupt();
+
+    /**
+     * Get the clock rate of the current transaction.
+     *
+     * @return Clock rate in Hz, or 0 if no transaction is active.
+     */
+    uint32_t getClock();
+
+    /**
+     * Simulate MISO looped back to MOSI.
+     * Up to the given clock rate the transferred byte is read back intact, above it a bit is corrupted.
+     *
+     * @param maxClock Highest clock rate in Hz that reads back intact, or 0 to disconnect MISO.
+     */
+    void setLoopback(uint32_t maxClock);
+
+    /**
+     * Get the total number of transferred bytes.
+     *
+     * @return Transfer count.
+     */
+    uint32_t getTransferCount();
+
+    /**
+     * Capture transferred bytes into the given buffer, until it is full.
+     *
+     * @param buffer Capture buffer, or NULL to stop capturing.
+     * @param size Size of the capture buffer.
+     */
+    void setCapture(uint8_t* buffer, uint32_t size);
+
+    /**
+     * Get the number of captured bytes.
+     *
+     * @return Capture length.
+     */
+    uint32_t getCaptureLength();
+};
+
+extern SPIClass SPI;
+
+#endif // LEDSTRIPDRIVER_HOST_SPI_H
\ No newline at end of file